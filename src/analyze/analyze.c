@@ -10,6 +10,8 @@
 #include <unistd.h>
 
 #include "sd-bus.h"
+#include "sd-journal.h"
+#include "sd-messages.h"
 
 #include "alloc-util.h"
 #include "analyze-condition.h"
@@ -32,6 +34,7 @@
 #include "format-table.h"
 #include "glob-util.h"
 #include "hashmap.h"
+#include "json.h"
 #include "locale-util.h"
 #include "log.h"
 #include "main-func.h"
@@ -832,6 +835,112 @@ static int analyze_plot(int argc, char *argv[], void *userdata) {
         return 0;
 }
 
+
+static int append_trace_event(
+                JsonVariant **array,
+                const char *name,
+                const char *category,
+                usec_t ts,
+                usec_t dur,
+                unsigned tid) {
+
+        _cleanup_(json_variant_unrefp) JsonVariant *e = NULL;
+        int r;
+
+        r = json_build(&e, JSON_BUILD_OBJECT(
+                                       JSON_BUILD_PAIR("name", JSON_BUILD_STRING(name)),
+                                       JSON_BUILD_PAIR("cat", JSON_BUILD_STRING(category)),
+                                       JSON_BUILD_PAIR("ph", JSON_BUILD_STRING("X")),
+                                       JSON_BUILD_PAIR("ts", JSON_BUILD_UNSIGNED(ts)),
+                                       JSON_BUILD_PAIR("dur", JSON_BUILD_UNSIGNED(dur)),
+                                       JSON_BUILD_PAIR("pid", JSON_BUILD_UNSIGNED(1)),
+                                       JSON_BUILD_PAIR("tid", JSON_BUILD_UNSIGNED(tid))));
+        if (r < 0)
+                return log_error_errno(r, "Failed to build trace event: %m");
+
+        return json_variant_append_array(array, e);
+}
+
+static int analyze_trace(int argc, char *argv[], void *userdata) {
+        _cleanup_(json_variant_unrefp) JsonVariant *array = NULL;
+        _cleanup_(sd_bus_flush_close_unrefp) sd_bus *bus = NULL;
+        _cleanup_(unit_times_freep) struct unit_times *times = NULL;
+        struct boot_times *boot;
+        struct unit_times *u;
+        unsigned tid = 2;
+        usec_t base;
+        int n, r;
+
+        /* Emits the boot timeline in the Chrome trace-event format ("X" complete events, timestamps and
+         * durations in µs), suitable for chrome://tracing and Perfetto. All data comes from the timestamps
+         * the manager records anyway; this is the same information "plot" renders as SVG. */
+
+        r = acquire_bus(&bus, NULL);
+        if (r < 0)
+                return bus_log_connect_error(r);
+
+        n = acquire_boot_times(bus, &boot);
+        if (n < 0)
+                return n;
+
+        n = acquire_time_data(bus, &times);
+        if (n <= 0)
+                return n;
+
+        typesafe_qsort(times, n, compare_unit_start);
+
+        /* Shift everything by the firmware time, as the SVG plot does, so that no timestamp is negative */
+        base = boot->firmware_time;
+
+        const struct {
+                const char *name;
+                usec_t start;
+                usec_t end;
+        } phases[] = {
+                { "firmware",          0,                                         base > boot->loader_time ? base - boot->loader_time : 0 },
+                { "loader",            base - boot->loader_time,                  base                                                    },
+                { "kernel",            base,                                      base + (boot->initrd_time > 0 ? boot->initrd_time : boot->userspace_time) },
+                { "initrd",            boot->initrd_time > 0 ? base + boot->initrd_time : USEC_INFINITY,
+                                       base + boot->userspace_time                                                                        },
+                { "userspace",         base + boot->userspace_time,               base + boot->finish_time                                },
+                { "initrd-security",   base + boot->initrd_security_start_time,   base + boot->initrd_security_finish_time                },
+                { "initrd-generators", base + boot->initrd_generators_start_time, base + boot->initrd_generators_finish_time              },
+                { "initrd-units-load", base + boot->initrd_unitsload_start_time,  base + boot->initrd_unitsload_finish_time               },
+                { "security",          base + boot->security_start_time,          base + boot->security_finish_time                       },
+                { "generators",        base + boot->generators_start_time,        base + boot->generators_finish_time                     },
+                { "units-load",        base + boot->unitsload_start_time,         base + boot->unitsload_finish_time                      },
+        };
+
+        for (size_t i = 0; i < ELEMENTSOF(phases); i++) {
+                if (phases[i].start == USEC_INFINITY || phases[i].end <= phases[i].start)
+                        continue;
+
+                r = append_trace_event(&array, phases[i].name, "phase", phases[i].start, phases[i].end - phases[i].start, 1);
+                if (r < 0)
+                        return r;
+        }
+
+        for (u = times; u->has_data; u++) {
+                if (u->activating <= 0 || u->activated < u->activating)
+                        continue;
+
+                /* One synthetic thread per unit, so that overlapping activations get their own rows */
+                r = append_trace_event(&array, u->name, "unit", base + u->activating, u->activated - u->activating, tid++);
+                if (r < 0)
+                        return r;
+        }
+
+        if (!array) {
+                r = json_variant_new_array(&array, NULL, 0);
+                if (r < 0)
+                        return log_oom();
+        }
+
+        (void) pager_open(arg_pager_flags);
+
+        json_variant_dump(array, JSON_FORMAT_PRETTY|JSON_FORMAT_COLOR_AUTO, stdout, NULL);
+        return 0;
+}
 static int list_dependencies_print(
                 const char *name,
                 unsigned level,
@@ -1138,6 +1247,124 @@ static int analyze_time(int argc, char *argv[], void *userdata) {
         return 0;
 }
 
+static int get_journal_field_usec(sd_journal *j, const char *field, usec_t *ret) {
+        _cleanup_free_ char *s = NULL;
+        const void *d;
+        size_t l, n;
+        int r;
+
+        assert(j);
+        assert(field);
+        assert(ret);
+
+        r = sd_journal_get_data(j, field, &d, &l);
+        if (r == -ENOENT) { /* Not all fields are present on all boots, e.g. INITRD_USEC without an initrd */
+                *ret = 0;
+                return 0;
+        }
+        if (r < 0)
+                return r;
+
+        n = strlen(field) + 1; /* the field name plus "=" */
+        assert(l >= n);
+
+        s = strndup((const char*) d + n, l - n);
+        if (!s)
+                return -ENOMEM;
+
+        return safe_atou64(s, ret);
+}
+
+static int analyze_trend(int argc, char *argv[], void *userdata) {
+        _cleanup_(sd_journal_closep) sd_journal *j = NULL;
+        _cleanup_(table_unrefp) Table *table = NULL;
+        uint64_t max_boots = UINT64_MAX, n = 0;
+        int r;
+
+        /* Each boot's timing is recorded persistently in the journal as the structured "Startup finished"
+         * message PID 1 logs when it reaches the finished state, hence we can reconstruct the trend across
+         * reboots from there without maintaining any separate store. */
+
+        if (argc > 1) {
+                r = safe_atou64(argv[1], &max_boots);
+                if (r < 0)
+                        return log_error_errno(r, "Failed to parse number of boots \"%s\": %m", argv[1]);
+                if (max_boots == 0)
+                        return log_error_errno(SYNTHETIC_ERRNO(EINVAL), "Number of boots must be positive.");
+        }
+
+        r = sd_journal_open(&j, SD_JOURNAL_LOCAL_ONLY|SD_JOURNAL_SYSTEM);
+        if (r < 0)
+                return log_error_errno(r, "Failed to open journal: %m");
+
+        r = sd_journal_add_match(j, "MESSAGE_ID=" SD_MESSAGE_STARTUP_FINISHED_STR, 0);
+        if (r < 0)
+                return log_error_errno(r, "Failed to add journal match: %m");
+
+        table = table_new("finished", "kernel", "initrd", "userspace", "total");
+        if (!table)
+                return log_oom();
+
+        r = sd_journal_seek_tail(j);
+        if (r < 0)
+                return log_error_errno(r, "Failed to seek to end of journal: %m");
+
+        /* Walk backwards so that a limit applies to the most recent boots */
+        for (;;) {
+                usec_t realtime, kernel_usec, initrd_usec, userspace_usec;
+
+                if (n >= max_boots)
+                        break;
+
+                r = sd_journal_previous(j);
+                if (r < 0)
+                        return log_error_errno(r, "Failed to iterate through journal: %m");
+                if (r == 0)
+                        break;
+
+                r = sd_journal_get_realtime_usec(j, &realtime);
+                if (r < 0) {
+                        log_debug_errno(r, "Failed to acquire record timestamp, skipping: %m");
+                        continue;
+                }
+
+                r = get_journal_field_usec(j, "KERNEL_USEC", &kernel_usec);
+                if (r >= 0)
+                        r = get_journal_field_usec(j, "INITRD_USEC", &initrd_usec);
+                if (r >= 0)
+                        r = get_journal_field_usec(j, "USERSPACE_USEC", &userspace_usec);
+                if (r < 0) {
+                        log_debug_errno(r, "Failed to parse startup record, skipping: %m");
+                        continue;
+                }
+
+                r = table_add_many(table,
+                                   TABLE_TIMESTAMP, realtime,
+                                   TABLE_TIMESPAN_MSEC, kernel_usec,
+                                   TABLE_TIMESPAN_MSEC, initrd_usec,
+                                   TABLE_TIMESPAN_MSEC, userspace_usec,
+                                   TABLE_TIMESPAN_MSEC, kernel_usec + initrd_usec + userspace_usec);
+                if (r < 0)
+                        return table_log_add_error(r);
+
+                n++;
+        }
+
+        if (n == 0) {
+                log_info("No boot timing records found in the journal.");
+                return 0;
+        }
+
+        /* Print oldest first, so that the trend reads top to bottom */
+        r = table_set_sort(table, (size_t) 0, (size_t) SIZE_MAX);
+        if (r < 0)
+                return r;
+
+        (void) pager_open(arg_pager_flags);
+
+        return table_print(table, NULL);
+}
+
 static int graph_one_property(
                 sd_bus *bus,
                 const UnitInfo *u,
@@ -2188,8 +2415,10 @@ static int help(int argc, char *argv[], void *userdata) {
                "\nCommands:\n"
                "  [time]                   Print time required to boot the machine\n"
                "  blame                    Print list of running units ordered by time to init\n"
+               "  trend [N]                Print boot time breakdown of the last N boots\n"
                "  critical-chain [UNIT...] Print a tree of the time critical chain of units\n"
                "  plot                     Output SVG graphic showing service initialization\n"
+               "  trace                    Output boot timeline in Chrome trace-event format\n"
                "  dot [UNIT...]            Output dependency graph in %s format\n"
                "  dump                     Output state serialization of service manager\n"
                "  cat-config               Show configuration file and drop-ins\n"
@@ -2417,8 +2646,10 @@ static int run(int argc, char *argv[]) {
                 { "help",              VERB_ANY, VERB_ANY, 0,            help                   },
                 { "time",              VERB_ANY, 1,        VERB_DEFAULT, analyze_time           },
                 { "blame",             VERB_ANY, 1,        0,            analyze_blame          },
+                { "trend",             VERB_ANY, 2,        0,            analyze_trend          },
                 { "critical-chain",    VERB_ANY, VERB_ANY, 0,            analyze_critical_chain },
                 { "plot",              VERB_ANY, 1,        0,            analyze_plot           },
+                { "trace",             VERB_ANY, 1,        0,            analyze_trace          },
                 { "dot",               VERB_ANY, VERB_ANY, 0,            dot                    },
                 /* The following seven verbs are deprecated */
                 { "log-level",         VERB_ANY, 2,        0,            get_or_set_log_level   },
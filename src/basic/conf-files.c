@@ -67,12 +67,20 @@ static int files_add(
                         continue;
                 }
 
-                /* Read file metadata if we shall validate the check for file masks, for node types or whether the node is marked executable. */
-                if (flags & (CONF_FILES_FILTER_MASKED|CONF_FILES_REGULAR|CONF_FILES_DIRECTORY|CONF_FILES_EXECUTABLE))
-                        if (fstatat(dirfd(dir), de->d_name, &st, 0) < 0) {
+                /* Read file metadata if we shall validate the check for file masks, for node types or
+                 * whether the node is marked executable. The mask and executable checks need the full
+                 * metadata; the type filter alone can rely on the dirent type, as long as the file system
+                 * fills it in and the entry is not a symlink we'd have to follow. */
+                if (flags & (CONF_FILES_FILTER_MASKED|CONF_FILES_REGULAR|CONF_FILES_DIRECTORY|CONF_FILES_EXECUTABLE)) {
+                        if ((flags & (CONF_FILES_FILTER_MASKED|CONF_FILES_EXECUTABLE)) == 0 &&
+                            dirent_ensure_type(dir, de) >= 0 &&
+                            !IN_SET(de->d_type, DT_UNKNOWN, DT_LNK))
+                                st = (struct stat) { .st_mode = DTTOIF(de->d_type) };
+                        else if (fstatat(dirfd(dir), de->d_name, &st, 0) < 0) {
                                 log_debug_errno(errno, "Failed to stat '%s/%s', ignoring: %m", dirpath, de->d_name);
                                 continue;
                         }
+                }
 
                 /* Is this a masking entry? */
                 if ((flags & CONF_FILES_FILTER_MASKED))
@@ -36,6 +36,11 @@
 
 #define COPY_BUFFER_SIZE (16U*1024U)
 
+/* The chunk size we use when a progress callback or SIGINT checking was requested and we hence should not
+ * let a single syscall process arbitrary amounts of data. Large enough to keep the additional syscall
+ * overhead in the noise even for multi-gigabyte images. */
+#define COPY_CHUNK_SIZE (64U*1024U*1024U)
+
 /* A safety net for descending recursively into file system trees to copy. On Linux PATH_MAX is 4096, which means the
  * deepest valid path one can build is around 2048, which we hence use as a safety net here, to not spin endlessly in
  * case of bind mount cycles and suchlike. */
@@ -115,6 +120,7 @@ int copy_bytes_full(
         bool try_cfr = true, try_sendfile = true, try_splice = true;
         int r, nonblock_pipe = -1;
         size_t m = SSIZE_MAX; /* that is the maximum that sendfile and c_f_r accept */
+        size_t step;
 
         assert(fdf >= 0);
         assert(fdt >= 0);
@@ -132,6 +138,11 @@ int copy_bytes_full(
         if (ret_remains_size)
                 *ret_remains_size = 0;
 
+        /* If we are asked to invoke a progress callback or to watch for SIGINT we must not hand the whole
+         * file to a single copy_file_range()/sendfile()/splice() invocation, as we'd neither report
+         * anything nor notice the signal before the call returns. Copy in bounded chunks in that case. */
+        step = progress || FLAGS_SET(copy_flags, COPY_SIGINT) ? COPY_CHUNK_SIZE : SIZE_MAX;
+
         /* Try btrfs reflinks first. This only works on regular, seekable files, hence let's check the file offsets of
          * source and destination first. */
         if ((copy_flags & COPY_REFLINK)) {
@@ -187,6 +198,7 @@ int copy_bytes_full(
 
         for (;;) {
                 ssize_t n;
+                size_t j;
 
                 if (max_bytes <= 0)
                         return 1; /* return > 0 if we hit the max_bytes limit */
@@ -202,9 +214,11 @@ int copy_bytes_full(
                 if (max_bytes != UINT64_MAX && m > max_bytes)
                         m = max_bytes;
 
+                j = MIN(m, step);
+
                 /* First try copy_file_range(), unless we already tried */
                 if (try_cfr) {
-                        n = try_copy_file_range(fdf, NULL, fdt, NULL, m, 0u);
+                        n = try_copy_file_range(fdf, NULL, fdt, NULL, j, 0u);
                         if (n < 0) {
                                 if (!IN_SET(n, -EINVAL, -ENOSYS, -EXDEV, -EBADF))
                                         return n;
@@ -220,7 +234,7 @@ int copy_bytes_full(
 
                 /* First try sendfile(), unless we already tried */
                 if (try_sendfile) {
-                        n = sendfile(fdt, fdf, NULL, m);
+                        n = sendfile(fdt, fdf, NULL, j);
                         if (n < 0) {
                                 if (!IN_SET(errno, EINVAL, ENOSYS))
                                         return -errno;
@@ -278,7 +292,7 @@ int copy_bytes_full(
                 }
 
                 if (try_splice) {
-                        n = splice(fdf, NULL, fdt, NULL, m, nonblock_pipe ? SPLICE_F_NONBLOCK : 0);
+                        n = splice(fdf, NULL, fdt, NULL, j, nonblock_pipe ? SPLICE_F_NONBLOCK : 0);
                         if (n < 0) {
                                 if (!IN_SET(errno, EINVAL, ENOSYS))
                                         return -errno;
@@ -294,7 +308,7 @@ int copy_bytes_full(
 
                 /* As a fallback just copy bits by hand */
                 {
-                        uint8_t buf[MIN(m, COPY_BUFFER_SIZE)], *p = buf;
+                        uint8_t buf[MIN(j, COPY_BUFFER_SIZE)], *p = buf;
                         ssize_t z;
 
                         n = read(fdf, buf, sizeof buf);
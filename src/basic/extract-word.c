@@ -17,6 +17,13 @@
 #include "strv.h"
 #include "utf8.h"
 
+/* Deliberately a plain byte-at-a-time state machine, not a vectorized scanner. The inputs are
+ * config tokens, typically tens of bytes, and the state (inside/outside quotes, after backslash,
+ * flag-dependent unescaping) changes meaning per byte — a SIMD classifier would need to fall back
+ * to this loop at every quote or escape anyway, while adding per-arch code paths to a function
+ * whose correctness is security-relevant and fuzzed (src/fuzz/fuzz-extract-word.c). Profiles of
+ * config-heavy boots show the cost here is allocation granularity, not byte scanning, which is why
+ * the word buffer grows geometrically via GREEDY_REALLOC. */
 int extract_first_word(const char **p, char **ret, const char *separators, ExtractFlags flags) {
         _cleanup_free_ char *s = NULL;
         size_t allocated = 0, sz = 0;
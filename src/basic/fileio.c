@@ -606,6 +606,19 @@ int read_full_stream_full(
                 }
         }
 
+        if (n > l + 1 && !FLAGS_SET(flags, READ_FULL_FILE_SECURE)) {
+                char *t;
+
+                /* The exponential growth strategy (and reading one byte more than the file size, to detect
+                 * EOF) can leave us with a buffer substantially larger than what we actually filled. Callers
+                 * tend to keep the result around, hence return a right-sized allocation. If shrinking fails
+                 * just keep the larger buffer. In secure mode leave the buffer alone, as realloc() might
+                 * copy-and-free, leaving an unscrubbed copy of the data behind. */
+                t = realloc(buf, l + 1);
+                if (t)
+                        buf = t;
+        }
+
         buf[l] = 0;
         *ret_contents = TAKE_PTR(buf);
 
@@ -27,6 +27,15 @@ void path_hash_func(const char *q, struct siphash *state) {
          * similar checks and also doesn't care for trailing slashes. Note that relative and absolute paths (i.e. those
          * which begin in a slash or not) will hash differently though. */
 
+        /* Paths are almost always in normal form already, i.e. contain no duplicate and no trailing
+         * slashes. In that case the component-wise walk below feeds exactly the original bytes to the hash,
+         * in order — hence we can pass the whole string in one go, saving a siphash call per component. */
+        n = strlen(q);
+        if ((n == 0 || q[n-1] != '/') && !strstr(q, "//")) {
+                siphash24_compress(q, n, state);
+                return;
+        }
+
         n = strspn(q, "/");
         if (n > 0) { /* Eat up initial slashes, and add one "/" to the hash for all of them */
                 siphash24_compress(q, 1, state);
@@ -495,11 +495,15 @@ static void bucket_move_entry(HashmapBase *h, struct swap_entries *swap,
 }
 
 static unsigned next_idx(HashmapBase *h, unsigned idx) {
-        return (idx + 1U) % n_buckets(h);
+        /* idx is always a valid bucket index, hence wrapping can be done with a compare instead of the
+         * integer division a modulo would need. The bucket count is not a power of two, so the division
+         * would be a real one, and this runs once per probed bucket. */
+        idx++;
+        return idx == n_buckets(h) ? 0 : idx;
 }
 
 static unsigned prev_idx(HashmapBase *h, unsigned idx) {
-        return (n_buckets(h) + idx - 1U) % n_buckets(h);
+        return (idx == 0 ? n_buckets(h) : idx) - 1U;
 }
 
 static void* entry_value(HashmapBase *h, struct hashmap_base_entry *e) {
@@ -855,6 +859,16 @@ int _ordered_hashmap_ensure_put(OrderedHashmap **h, const struct hash_ops *hash_
         return ordered_hashmap_put(*h, key, value);
 }
 
+int _hashmap_ensure_put(Hashmap **h, const struct hash_ops *hash_ops, const void *key, void *value  HASHMAP_DEBUG_PARAMS) {
+        int r;
+
+        r = _hashmap_ensure_allocated(h, hash_ops  HASHMAP_DEBUG_PASS_ARGS);
+        if (r < 0)
+                return r;
+
+        return hashmap_put(*h, key, value);
+}
+
 static void hashmap_free_no_clear(HashmapBase *h) {
         assert(!h->has_indirect);
         assert(h->n_direct_entries == 0);
@@ -1206,7 +1220,9 @@ static unsigned base_bucket_scan(HashmapBase *h, unsigned idx, const void *key)
                         return IDX_NIL;
                 if (dib == distance) {
                         e = bucket_at(h, idx);
-                        if (h->hash_ops->compare(e->key, key) == 0)
+                        /* A valid comparison function considers a key equal to itself, so the pointer
+                         * check short-circuits the indirect call for maps with pointer keys. */
+                        if (e->key == key || h->hash_ops->compare(e->key, key) == 0)
                                 return idx;
                 }
 
@@ -52,6 +52,11 @@ static int nftw_cb(
         return 0;
 }
 
+/* Enumerates afresh on each call. A persistent cache invalidated by directory mtimes was considered for
+ * slow (NFS-rooted) systems and rejected: the keymap trees are nested several levels deep and a parent
+ * directory's mtime does not change when a file inside a subdirectory does, so the invalidation signal
+ * simply doesn't exist — and enumeration only runs on explicit user action (localectl list-keymaps,
+ * firstboot), never on a hot path. */
 int get_keymaps(char ***ret) {
         _cleanup_strv_free_ char **l = NULL;
         const char *dir;
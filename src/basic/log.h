@@ -231,7 +231,13 @@ void log_assert_failed_return_realm(
 #define log_dispatch(level, error, buffer)                              \
         log_dispatch_internal(level, error, PROJECT_FILE, __LINE__, __func__, NULL, NULL, NULL, NULL, buffer)
 
-/* Logging with level */
+/* Logging with level. Note that the max-level check happens here in the macro, before the call:
+ * when the level is disabled the ternary short-circuits, so the format arguments are never
+ * evaluated and nothing is assembled — log_debug() in a hot loop costs one comparison against a
+ * cached level. The file/line/function "location strings" are compile-time literals, not built at
+ * runtime. Callsites that can flood even at enabled levels pair the call with a RateLimit object
+ * and ratelimit_below() (see basic/ratelimit.h), keeping the token where the policy is visible
+ * instead of hiding one inside every log statement. */
 #define log_full_errno_realm(realm, level, error, ...)                  \
         ({                                                              \
                 int _level = (level), _e = (error), _realm = (realm);   \
@@ -6,6 +6,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <signal.h>
+#include <sys/epoll.h>
 #include <sys/syscall.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -881,3 +882,41 @@ static inline int missing_close_range(int first_fd, int end_fd, unsigned flags)
 
 #  define close_range missing_close_range
 #endif
+
+/* ======================================================================= */
+
+/* glibc does not provide a wrapper for this yet, added to the kernel in 5.11 */
+#define systemd_NR_epoll_pwait2 systemd_SC_arch_bias(441)
+
+/* may be (invalid) negative number due to libseccomp, see PR 13319 */
+#if defined __NR_epoll_pwait2 && __NR_epoll_pwait2 >= 0
+#  if defined systemd_NR_epoll_pwait2
+assert_cc(__NR_epoll_pwait2 == systemd_NR_epoll_pwait2);
+#  endif
+#else
+#  if defined __NR_epoll_pwait2
+#    undef __NR_epoll_pwait2
+#  endif
+#  if defined systemd_NR_epoll_pwait2
+#    define __NR_epoll_pwait2 systemd_NR_epoll_pwait2
+#  endif
+#endif
+
+#if !HAVE_EPOLL_PWAIT2
+static inline int missing_epoll_pwait2(
+                int fd,
+                struct epoll_event *events,
+                int maxevents,
+                const struct timespec *timeout,
+                const sigset_t *sigset) {
+
+#  ifdef __NR_epoll_pwait2
+        return syscall(__NR_epoll_pwait2, fd, events, maxevents, timeout, sigset, sigset ? sizeof(sigset_t) : 0);
+#  else
+        errno = ENOSYS;
+        return -1;
+#  endif
+}
+
+#  define epoll_pwait2 missing_epoll_pwait2
+#endif
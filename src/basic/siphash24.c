@@ -25,15 +25,14 @@
 #include "siphash24.h"
 #include "unaligned.h"
 
+/* These two run six resp. two times per 8 bytes of input of every hash computed in the tree, hence no
+ * asserts here: the rotation counts are compile-time constants below 64, and the state pointer is
+ * checked once in the public entry points. */
 static uint64_t rotate_left(uint64_t x, uint8_t b) {
-        assert(b < 64);
-
         return (x << b) | (x >> (64 - b));
 }
 
 static void sipround(struct siphash *state) {
-        assert(state);
-
         state->v0 += state->v1;
         state->v1 = rotate_left(state->v1, 13);
         state->v1 ^= state->v0;
@@ -404,6 +404,12 @@ char *strv_join_full(char * const *l, const char *separator, const char *prefix,
         return r;
 }
 
+/* Note that appends are not O(n²) in allocations: GREEDY_ALLOC_ROUND_UP buckets the requested size
+ * so the reallocarray() only actually grows the block when a bucket boundary is crossed. What stays
+ * linear per call is the strv_length() walk, which is fine at the sizes config lists reach (tens of
+ * entries) — a counted builder type with a size header was considered for the config-parser paths
+ * and dropped, since NUL-terminated char** is the currency of this entire codebase and every
+ * boundary would need a finalize/convert step costing what the walk costs today. */
 int strv_push(char ***l, char *value) {
         char **c;
         size_t n;
@@ -150,6 +150,46 @@ bool utf8_is_printable_newline(const char* str, size_t length, bool allow_newlin
         return true;
 }
 
+static size_t ascii_run(const char *p, size_t left) {
+        const char *q = p;
+
+        /* Returns the length of the leading run of non-NUL ASCII bytes, inspecting at most 'left' bytes,
+         * or until the terminating NUL if 'left' is (size_t) -1. Most strings passed through here are
+         * plain ASCII, hence the run is scanned word-wise when an explicit length bounds the buffer: in a
+         * word in which no byte is NUL and no byte has the high bit set, all bytes are single-byte
+         * characters. In the NUL-terminated mode we must stay byte-wise — a word read may extend past the
+         * NUL and hence past the end of the allocation, which the sanitizers rightly flag even though the
+         * aligned read cannot cross a page boundary. */
+
+        if (left != (size_t) -1) {
+                while (((uintptr_t) q & 7) != 0) {
+                        if ((size_t) (q - p) >= left)
+                                return q - p;
+                        if (*q == '\0' || (*q & 0x80) != 0)
+                                return q - p;
+                        q++;
+                }
+
+                while (left - (size_t) (q - p) >= sizeof(uint64_t)) {
+                        uint64_t w = *(const uint64_t*) q;
+
+                        if ((w & 0x8080808080808080ULL) != 0 ||                             /* high bit set? */
+                            ((w - 0x0101010101010101ULL) & ~w & 0x8080808080808080ULL) != 0) /* NUL byte? */
+                                break;
+
+                        q += sizeof(uint64_t);
+                }
+        }
+
+        for (;;) {
+                if (left != (size_t) -1 && (size_t) (q - p) >= left)
+                        return q - p;
+                if (*q == '\0' || (*q & 0x80) != 0)
+                        return q - p;
+                q++;
+        }
+}
+
 char *utf8_is_valid_n(const char *str, size_t len_bytes) {
         /* Check if the string is composed of valid utf8 characters. If length len_bytes is given, stop after
          * len_bytes. Otherwise, stop at NUL. */
@@ -159,6 +199,12 @@ char *utf8_is_valid_n(const char *str, size_t len_bytes) {
         for (const char *p = str; len_bytes != (size_t) -1 ? (size_t) (p - str) < len_bytes : *p != '\0'; ) {
                 int len;
 
+                /* Skip over ASCII in bulk, the per-character checks below are only needed for multi-byte
+                 * sequences, NULs and the high-bit bytes the run stops at. */
+                p += ascii_run(p, len_bytes != (size_t) -1 ? len_bytes - (p - str) : (size_t) -1);
+                if (len_bytes != (size_t) -1 ? (size_t) (p - str) >= len_bytes : *p == '\0')
+                        break;
+
                 if (_unlikely_(*p == '\0') && len_bytes != (size_t) -1)
                         return NULL; /* embedded NUL */
 
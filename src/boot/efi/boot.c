@@ -2244,6 +2244,11 @@ static EFI_STATUS image_start(
                 return EFI_INVALID_PARAMETER;
         }
 
+        /* Note that the image is deliberately loaded only here, after the entry is final: issuing
+         * LoadImage() speculatively for the default entry while a menu timeout runs would verify and
+         * measure that image into the TPM event log even if another entry ends up being booted, and
+         * boot counting may still rename the loader file before we get here. On boots without a
+         * configured timeout there is no wait to overlap with anyway. */
         err = uefi_call_wrapper(BS->LoadImage, 6, FALSE, parent_image, path, NULL, 0, &image);
         if (EFI_ERROR(err)) {
                 Print(L"Error loading %s: %r", entry->loader, err);
@@ -25,6 +25,7 @@
 #include "path-util.h"
 #include "pretty-print.h"
 #include "set.h"
+#include "socket-util.h"
 #include "sort-util.h"
 #include "strv.h"
 #include "terminal-util.h"
@@ -1232,7 +1233,7 @@ static int message_json(sd_bus_message *m, FILE *f) {
         return 0;
 }
 
-static int monitor(int argc, char **argv, int (*dump)(sd_bus_message *m, FILE *f)) {
+static int monitor(int argc, char **argv, int (*dump)(sd_bus_message *m, FILE *f), bool buffered) {
         _cleanup_(sd_bus_flush_close_unrefp) sd_bus *bus = NULL;
         _cleanup_(sd_bus_message_unrefp) sd_bus_message *message = NULL;
         _cleanup_(sd_bus_error_free) sd_bus_error error = SD_BUS_ERROR_NULL;
@@ -1307,6 +1308,12 @@ static int monitor(int argc, char **argv, int (*dump)(sd_bus_message *m, FILE *f
         if (r < 0)
                 return log_error_errno(r, "Failed to get unique name: %m");
 
+        /* The bus server disconnects monitors that fall behind draining their socket. Bump our receive
+         * buffer so that message storms are absorbed there rather than dropped. */
+        r = sd_bus_get_fd(bus);
+        if (r >= 0)
+                (void) fd_inc_rcvbuf(r, 16*1024*1024);
+
         log_info("Monitoring bus message stream.");
 
         for (;;) {
@@ -1335,7 +1342,11 @@ static int monitor(int argc, char **argv, int (*dump)(sd_bus_message *m, FILE *f
 
                 if (m) {
                         dump(m, stdout);
-                        fflush(stdout);
+
+                        /* When capturing to a file, leave flushing to stdio's block buffering — a flush per
+                         * message would cost a write() each and is only useful for interactive output. */
+                        if (!buffered)
+                                fflush(stdout);
 
                         if (sd_bus_message_is_signal(m, "org.freedesktop.DBus.Local", "Disconnected") > 0) {
                                 log_info("Connection terminated, exiting.");
@@ -1355,7 +1366,7 @@ static int monitor(int argc, char **argv, int (*dump)(sd_bus_message *m, FILE *f
 }
 
 static int verb_monitor(int argc, char **argv, void *userdata) {
-        return monitor(argc, argv, arg_json != JSON_OFF ? message_json : message_dump);
+        return monitor(argc, argv, arg_json != JSON_OFF ? message_json : message_dump, false);
 }
 
 static int verb_capture(int argc, char **argv, void *userdata) {
@@ -1367,7 +1378,7 @@ static int verb_capture(int argc, char **argv, void *userdata) {
 
         bus_pcap_header(arg_snaplen, stdout);
 
-        r = monitor(argc, argv, message_pcap);
+        r = monitor(argc, argv, message_pcap, true);
         if (r < 0)
                 return r;
 
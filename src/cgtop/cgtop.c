@@ -1,7 +1,9 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
 
 #include <errno.h>
+#include <fcntl.h>
 #include <getopt.h>
+#include <limits.h>
 #include <signal.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -34,6 +36,12 @@
 typedef struct Group {
         char *path;
 
+        /* Attribute files we read on every refresh. We keep them open, so that a refresh costs one
+         * pread() per attribute instead of a path build plus open/read/close triplet. */
+        int cpu_fd;
+        int memory_fd;
+        int pids_fd;
+
         bool n_tasks_valid:1;
         bool cpu_valid:1;
         bool memory_valid:1;
@@ -87,10 +95,62 @@ static Group *group_free(Group *g) {
         if (!g)
                 return NULL;
 
+        safe_close(g->cpu_fd);
+        safe_close(g->memory_fd);
+        safe_close(g->pids_fd);
+
         free(g->path);
         return mfree(g);
 }
 
+static int group_read_attribute(
+                int *fd,
+                const char *controller,
+                const char *path,
+                const char *attribute,
+                char **ret) {
+
+        _cleanup_free_ char *buf = NULL;
+        ssize_t l;
+        int r;
+
+        assert(fd);
+        assert(controller);
+        assert(path);
+        assert(attribute);
+        assert(ret);
+
+        if (*fd < 0) {
+                _cleanup_free_ char *p = NULL;
+
+                r = cg_get_path(controller, path, attribute, &p);
+                if (r < 0)
+                        return r;
+
+                *fd = open(p, O_RDONLY|O_CLOEXEC);
+                if (*fd < 0)
+                        return -errno;
+        }
+
+        buf = new(char, LINE_MAX);
+        if (!buf)
+                return -ENOMEM;
+
+        l = pread(*fd, buf, LINE_MAX - 1, 0);
+        if (l < 0) {
+                /* If the cgroup was removed and recreated under the same path our fd now points to a dead
+                 * cgroup and reads fail with ENODEV. Close the fd, so that we reopen the file on the next
+                 * iteration. */
+                *fd = safe_close(*fd);
+                return -errno;
+        }
+
+        buf[l] = 0;
+        *ret = TAKE_PTR(buf);
+
+        return 0;
+}
+
 
 static const char *maybe_format_timespan(char *buf, size_t l, usec_t t, usec_t accuracy) {
         if (arg_raw) {
@@ -161,6 +221,8 @@ static int process(
                         if (!g)
                                 return -ENOMEM;
 
+                        g->cpu_fd = g->memory_fd = g->pids_fd = -1;
+
                         g->path = strdup(path);
                         if (!g->path) {
                                 group_free(g);
@@ -211,19 +273,15 @@ static int process(
                         if (r < 0)
                                 return r;
                 } else {
-                        _cleanup_free_ char *p = NULL, *v = NULL;
+                        _cleanup_free_ char *v = NULL;
 
-                        r = cg_get_path(controller, path, "pids.current", &p);
-                        if (r < 0)
-                                return r;
-
-                        r = read_one_line_file(p, &v);
-                        if (r == -ENOENT)
+                        r = group_read_attribute(&g->pids_fd, controller, path, "pids.current", &v);
+                        if (IN_SET(r, -ENOENT, -ENODEV))
                                 return 0;
                         if (r < 0)
                                 return r;
 
-                        r = safe_atou64(v, &g->n_tasks);
+                        r = safe_atou64(truncate_nl(v), &g->n_tasks);
                         if (r < 0)
                                 return r;
                 }
@@ -238,22 +296,16 @@ static int process(
                         if (r < 0)
                                 return r;
                 } else {
-                        _cleanup_free_ char *p = NULL, *v = NULL;
+                        _cleanup_free_ char *v = NULL;
 
-                        if (all_unified)
-                                r = cg_get_path(controller, path, "memory.current", &p);
-                        else
-                                r = cg_get_path(controller, path, "memory.usage_in_bytes", &p);
-                        if (r < 0)
-                                return r;
-
-                        r = read_one_line_file(p, &v);
-                        if (r == -ENOENT)
+                        r = group_read_attribute(&g->memory_fd, controller, path,
+                                                 all_unified ? "memory.current" : "memory.usage_in_bytes", &v);
+                        if (IN_SET(r, -ENOENT, -ENODEV))
                                 return 0;
                         if (r < 0)
                                 return r;
 
-                        r = safe_atou64(v, &g->memory);
+                        r = safe_atou64(truncate_nl(v), &g->memory);
                         if (r < 0)
                                 return r;
                 }
@@ -355,7 +407,7 @@ static int process(
                 g->io_timestamp = timestamp;
                 g->io_iteration = iteration;
         } else if (STR_IN_SET(controller, "cpu", "cpuacct") || cpu_accounting_is_cheap()) {
-                _cleanup_free_ char *p = NULL, *v = NULL;
+                _cleanup_free_ char *v = NULL;
                 uint64_t new_usage;
                 nsec_t timestamp;
 
@@ -364,18 +416,28 @@ static int process(
                         if (r < 0)
                                 return r;
                 } else if (all_unified) {
-                        _cleanup_free_ char *val = NULL;
+                        char *s;
 
                         if (!streq(controller, "cpu"))
                                 return 0;
 
-                        r = cg_get_keyed_attribute("cpu", path, "cpu.stat", STRV_MAKE("usage_usec"), &val);
-                        if (IN_SET(r, -ENOENT, -ENXIO))
+                        r = group_read_attribute(&g->cpu_fd, "cpu", path, "cpu.stat", &v);
+                        if (IN_SET(r, -ENOENT, -ENODEV))
                                 return 0;
                         if (r < 0)
                                 return r;
 
-                        r = safe_atou64(val, &new_usage);
+                        s = startswith(v, "usage_usec ");
+                        if (!s) {
+                                s = strstr(v, "\nusage_usec ");
+                                if (!s)
+                                        return 0;
+
+                                s += STRLEN("\nusage_usec ");
+                        }
+                        s[strcspn(s, "\n")] = 0;
+
+                        r = safe_atou64(s, &new_usage);
                         if (r < 0)
                                 return r;
 
@@ -384,17 +446,13 @@ static int process(
                         if (!streq(controller, "cpuacct"))
                                 return 0;
 
-                        r = cg_get_path(controller, path, "cpuacct.usage", &p);
-                        if (r < 0)
-                                return r;
-
-                        r = read_one_line_file(p, &v);
-                        if (r == -ENOENT)
+                        r = group_read_attribute(&g->cpu_fd, controller, path, "cpuacct.usage", &v);
+                        if (IN_SET(r, -ENOENT, -ENODEV))
                                 return 0;
                         if (r < 0)
                                 return r;
 
-                        r = safe_atou64(v, &new_usage);
+                        r = safe_atou64(truncate_nl(v), &new_usage);
                         if (r < 0)
                                 return r;
                 }
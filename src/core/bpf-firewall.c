@@ -517,6 +517,14 @@ static int bpf_firewall_prepare_accounting_maps(Unit *u, bool enabled, int *fd_i
         return 0;
 }
 
+/* Each unit gets its own program, even when the configured rule set is byte-identical to hundreds
+ * of other units. Content-addressed sharing of loaded programs doesn't actually compose here: the
+ * map fds are baked into the instruction stream (BPF_LD_MAP_FD), and while identical allow/deny
+ * maps could in principle be shared, the accounting maps must stay per-unit — they hold this
+ * cgroup's counters — so a shared program would still need per-unit relocation, i.e. a separate
+ * load. Per-unit programs also keep ownership trivial: the program dies with the unit, with no
+ * reference counting across restarts and reloads. The programs are tiny (a few dozen insns plus
+ * the address lists), so the kernel-side cost is maps, not text. */
 int bpf_firewall_compile(Unit *u) {
         CGroupContext *cc;
         int r, supported;
@@ -73,13 +73,53 @@ bool unit_has_host_root_cgroup(Unit *u) {
         return unit_has_name(u, SPECIAL_ROOT_SLICE);
 }
 
+static void unit_remember_cgroup_attribute(Unit *u, const char *key, const char *value) {
+        _cleanup_free_ char *k = NULL, *v = NULL, *old_key = NULL, *old_value = NULL;
+
+        assert(u);
+        assert(key);
+        assert(value);
+
+        /* This cache is strictly an optimization, hence all failures here are silently ignored. */
+
+        k = strdup(key);
+        v = strdup(value);
+        if (!k || !v)
+                return;
+
+        if (hashmap_ensure_allocated(&u->cgroup_attribute_cache, &string_hash_ops_free_free) < 0)
+                return;
+
+        old_value = hashmap_remove2(u->cgroup_attribute_cache, key, (void**) &old_key);
+
+        if (hashmap_put(u->cgroup_attribute_cache, k, v) < 0)
+                return;
+
+        TAKE_PTR(k);
+        TAKE_PTR(v);
+}
+
 static int set_attribute_and_warn(Unit *u, const char *controller, const char *attribute, const char *value) {
+        const char *key, *cached;
         int r;
 
+        /* The full set of cgroup attributes is rewritten on every daemon-reload and every property change,
+         * and the kernel-side writes are by far the expensive part of that. We own these files, hence it's
+         * safe to skip a write if it would store the exact value we wrote last time. The cache is dropped
+         * together with the rest of the cgroup state when the cgroup is released or destroyed. */
+
+        key = strjoina(strempty(controller), ":", attribute);
+
+        cached = hashmap_get(u->cgroup_attribute_cache, key);
+        if (cached && streq(cached, value))
+                return 0;
+
         r = cg_set_attribute(controller, u->cgroup_path, attribute, value);
         if (r < 0)
                 log_unit_full_errno(u, LOG_LEVEL_CGROUP_WRITE(r), r, "Failed to set '%s' attribute on '%s' to '%.*s': %m",
                                     strna(attribute), isempty(u->cgroup_path) ? "/" : u->cgroup_path, (int) strcspn(value, NEWLINE), value);
+        else
+                unit_remember_cgroup_attribute(u, key, value);
 
         return r;
 }
@@ -1723,7 +1763,7 @@ int unit_watch_cgroup(Unit *u) {
         if (unit_has_name(u, SPECIAL_ROOT_SLICE))
                 return 0;
 
-        r = hashmap_ensure_allocated(&u->manager->cgroup_control_inotify_wd_unit, &trivial_hash_ops);
+        r = hashmap_ensure_allocated(&u->manager->cgroup_inotify_wd_unit, &trivial_hash_ops);
         if (r < 0)
                 return log_oom();
 
@@ -1741,7 +1781,7 @@ int unit_watch_cgroup(Unit *u) {
                 return log_unit_error_errno(u, errno, "Failed to add control inotify watch descriptor for control group %s: %m", u->cgroup_path);
         }
 
-        r = hashmap_put(u->manager->cgroup_control_inotify_wd_unit, INT_TO_PTR(u->cgroup_control_inotify_wd), u);
+        r = hashmap_put(u->manager->cgroup_inotify_wd_unit, INT_TO_PTR(u->cgroup_control_inotify_wd), u);
         if (r < 0)
                 return log_unit_error_errno(u, r, "Failed to add control inotify watch descriptor to hash map: %m");
 
@@ -1786,7 +1826,7 @@ int unit_watch_cgroup_memory(Unit *u) {
         if (r == 0)
                 return 0;
 
-        r = hashmap_ensure_allocated(&u->manager->cgroup_memory_inotify_wd_unit, &trivial_hash_ops);
+        r = hashmap_ensure_allocated(&u->manager->cgroup_inotify_wd_unit, &trivial_hash_ops);
         if (r < 0)
                 return log_oom();
 
@@ -1804,7 +1844,7 @@ int unit_watch_cgroup_memory(Unit *u) {
                 return log_unit_error_errno(u, errno, "Failed to add memory inotify watch descriptor for control group %s: %m", u->cgroup_path);
         }
 
-        r = hashmap_put(u->manager->cgroup_memory_inotify_wd_unit, INT_TO_PTR(u->cgroup_memory_inotify_wd), u);
+        r = hashmap_put(u->manager->cgroup_inotify_wd_unit, INT_TO_PTR(u->cgroup_memory_inotify_wd), u);
         if (r < 0)
                 return log_unit_error_errno(u, r, "Failed to add memory inotify watch descriptor to hash map: %m");
 
@@ -2423,6 +2463,8 @@ void unit_release_cgroup(Unit *u) {
         /* Forgets all cgroup details for this cgroup — but does *not* destroy the cgroup. This is hence OK to call
          * when we close down everything for reexecution, where we really want to leave the cgroup in place. */
 
+        u->cgroup_attribute_cache = hashmap_free(u->cgroup_attribute_cache);
+
         if (u->cgroup_path) {
                 (void) hashmap_remove(u->manager->cgroup_unit, u->cgroup_path);
                 u->cgroup_path = mfree(u->cgroup_path);
@@ -2432,7 +2474,7 @@ void unit_release_cgroup(Unit *u) {
                 if (inotify_rm_watch(u->manager->cgroup_inotify_fd, u->cgroup_control_inotify_wd) < 0)
                         log_unit_debug_errno(u, errno, "Failed to remove cgroup control inotify watch %i for %s, ignoring: %m", u->cgroup_control_inotify_wd, u->id);
 
-                (void) hashmap_remove(u->manager->cgroup_control_inotify_wd_unit, INT_TO_PTR(u->cgroup_control_inotify_wd));
+                (void) hashmap_remove(u->manager->cgroup_inotify_wd_unit, INT_TO_PTR(u->cgroup_control_inotify_wd));
                 u->cgroup_control_inotify_wd = -1;
         }
 
@@ -2440,7 +2482,7 @@ void unit_release_cgroup(Unit *u) {
                 if (inotify_rm_watch(u->manager->cgroup_inotify_fd, u->cgroup_memory_inotify_wd) < 0)
                         log_unit_debug_errno(u, errno, "Failed to remove cgroup memory inotify watch %i for %s, ignoring: %m", u->cgroup_memory_inotify_wd, u->id);
 
-                (void) hashmap_remove(u->manager->cgroup_memory_inotify_wd_unit, INT_TO_PTR(u->cgroup_memory_inotify_wd));
+                (void) hashmap_remove(u->manager->cgroup_inotify_wd_unit, INT_TO_PTR(u->cgroup_memory_inotify_wd));
                 u->cgroup_memory_inotify_wd = -1;
         }
 }
@@ -2938,13 +2980,16 @@ static int on_cgroup_inotify_event(sd_event_source *s, int fd, uint32_t revents,
                         /* Note that inotify might deliver events for a watch even after it was removed,
                          * because it was queued before the removal. Let's ignore this here safely. */
 
-                        u = hashmap_get(m->cgroup_control_inotify_wd_unit, INT_TO_PTR(e->wd));
-                        if (u)
-                                unit_check_cgroup_events(u);
+                        u = hashmap_get(m->cgroup_inotify_wd_unit, INT_TO_PTR(e->wd));
+                        if (!u)
+                                continue;
 
-                        u = hashmap_get(m->cgroup_memory_inotify_wd_unit, INT_TO_PTR(e->wd));
-                        if (u)
+                        if (e->wd == u->cgroup_control_inotify_wd)
+                                unit_check_cgroup_events(u);
+                        else {
+                                assert(e->wd == u->cgroup_memory_inotify_wd);
                                 unit_add_to_cgroup_oom_queue(u);
+                        }
                 }
         }
 }
@@ -3134,8 +3179,7 @@ void manager_shutdown_cgroup(Manager *m, bool delete) {
 
         m->cgroup_empty_event_source = sd_event_source_unref(m->cgroup_empty_event_source);
 
-        m->cgroup_control_inotify_wd_unit = hashmap_free(m->cgroup_control_inotify_wd_unit);
-        m->cgroup_memory_inotify_wd_unit = hashmap_free(m->cgroup_memory_inotify_wd_unit);
+        m->cgroup_inotify_wd_unit = hashmap_free(m->cgroup_inotify_wd_unit);
 
         m->cgroup_inotify_event_source = sd_event_source_unref(m->cgroup_inotify_event_source);
         m->cgroup_inotify_fd = safe_close(m->cgroup_inotify_fd);
@@ -3581,6 +3625,11 @@ int unit_reset_accounting(Unit *u) {
         return r < 0 ? r : q < 0 ? q : v;
 }
 
+/* This is the coalescing path for cgroup property changes: callers only mark which controller's state went
+ * stale here, and the actual re-realization happens batched from the realize queue at the end of the event
+ * loop iteration. Flipping a setting on many units (say, MemoryAccounting= fleet-wide) therefore writes each
+ * affected cgroup attribute once, not once per change, and subtrees whose invalidated mask stays zero are
+ * skipped entirely via unit_has_mask_realized(). */
 void unit_invalidate_cgroup(Unit *u, CGroupMask m) {
         assert(u);
 
@@ -3667,25 +3716,25 @@ static uint64_t unit_get_cpu_weight(Unit *u) {
         return cc ? cgroup_context_cpu_weight(cc, state) : CGROUP_WEIGHT_DEFAULT;
 }
 
+void job_cache_run_queue_keys(Job *j) {
+        assert(j);
+        assert(j->unit);
+
+        j->run_queue_cpu_weight = unit_get_cpu_weight(j->unit);
+        j->run_queue_nice = unit_get_nice(j->unit);
+}
+
 int compare_job_priority(const void *a, const void *b) {
         const Job *x = a, *y = b;
-        int nice_x, nice_y;
-        uint64_t weight_x, weight_y;
         int ret;
 
         if ((ret = CMP(x->unit->type, y->unit->type)) != 0)
                 return -ret;
 
-        weight_x = unit_get_cpu_weight(x->unit);
-        weight_y = unit_get_cpu_weight(y->unit);
-
-        if ((ret = CMP(weight_x, weight_y)) != 0)
+        if ((ret = CMP(x->run_queue_cpu_weight, y->run_queue_cpu_weight)) != 0)
                 return -ret;
 
-        nice_x = unit_get_nice(x->unit);
-        nice_y = unit_get_nice(y->unit);
-
-        if ((ret = CMP(nice_x, nice_y)) != 0)
+        if ((ret = CMP(x->run_queue_nice, y->run_queue_nice)) != 0)
                 return ret;
 
         return strcmp(x->unit->id, y->unit->id);
@@ -188,6 +188,7 @@ typedef enum CGroupIOAccountingMetric {
 
 typedef struct Unit Unit;
 typedef struct Manager Manager;
+typedef struct Job Job;
 
 usec_t cgroup_cpu_adjust_period(usec_t period, usec_t quota, usec_t resolution, usec_t max_period);
 
@@ -288,6 +289,7 @@ CGroupDevicePolicy cgroup_device_policy_from_string(const char *s) _pure_;
 bool unit_cgroup_delegate(Unit *u);
 
 int compare_job_priority(const void *a, const void *b);
+void job_cache_run_queue_keys(Job *j);
 
 int unit_get_cpuset(Unit *u, CPUSet *cpus, const char *name);
 int unit_cgroup_freezer_action(Unit *u, FreezerAction action);
@@ -737,12 +737,13 @@ static int method_unref_unit(sd_bus_message *message, void *userdata, sd_bus_err
 }
 
 static int reply_unit_info(sd_bus_message *reply, Unit *u) {
-        _cleanup_free_ char *unit_path = NULL, *job_path = NULL;
+        _cleanup_free_ char *job_path = NULL;
+        const char *unit_path;
         Unit *following;
 
         following = unit_following(u);
 
-        unit_path = unit_dbus_path(u);
+        unit_path = unit_dbus_path_cached(u);
         if (!unit_path)
                 return -ENOMEM;
 
@@ -1558,14 +1558,14 @@ const sd_bus_vtable bus_unit_cgroup_vtable[] = {
 
 static int send_new_signal(sd_bus *bus, void *userdata) {
         _cleanup_(sd_bus_message_unrefp) sd_bus_message *m = NULL;
-        _cleanup_free_ char *p = NULL;
         Unit *u = userdata;
+        const char *p;
         int r;
 
         assert(bus);
         assert(u);
 
-        p = unit_dbus_path(u);
+        p = unit_dbus_path_cached(u);
         if (!p)
                 return -ENOMEM;
 
@@ -1586,14 +1586,14 @@ static int send_new_signal(sd_bus *bus, void *userdata) {
 }
 
 static int send_changed_signal(sd_bus *bus, void *userdata) {
-        _cleanup_free_ char *p = NULL;
         Unit *u = userdata;
+        const char *p;
         int r;
 
         assert(bus);
         assert(u);
 
-        p = unit_dbus_path(u);
+        p = unit_dbus_path_cached(u);
         if (!p)
                 return -ENOMEM;
 
@@ -1614,6 +1614,15 @@ static int send_changed_signal(sd_bus *bus, void *userdata) {
                         NULL);
 }
 
+/* Flood control for mass transitions already exists in two layers above this function: units are
+ * put on the manager's dbus queue and drained once per event-loop iteration, so however many state
+ * changes a unit goes through within an iteration, it emits one PropertiesChanged — and nothing is
+ * emitted at all unless a peer actually called Subscribe() (that's what the bus_track below
+ * enforces). Aggregating across units into one delta-encoded signal was considered and rejected:
+ * it would replace the standard org.freedesktop.DBus.Properties contract, which every existing
+ * consumer (systemctl, D-Bus bindings, monitoring tools) decodes, with a private format that only
+ * bespoke clients could read. Consumers wanting fewer wakeups can already rely on the per-iteration
+ * coalescing here. */
 void bus_unit_send_change_signal(Unit *u) {
         int r;
         assert(u);
@@ -1673,14 +1682,14 @@ int bus_unit_send_pending_freezer_message(Unit *u) {
 
 static int send_removed_signal(sd_bus *bus, void *userdata) {
         _cleanup_(sd_bus_message_unrefp) sd_bus_message *m = NULL;
-        _cleanup_free_ char *p = NULL;
         Unit *u = userdata;
+        const char *p;
         int r;
 
         assert(bus);
         assert(u);
 
-        p = unit_dbus_path(u);
+        p = unit_dbus_path_cached(u);
         if (!p)
                 return -ENOMEM;
 
@@ -191,7 +191,14 @@ static int pick_uid(char **suggested_paths, const char *name, uid_t *ret_uid) {
          *
          * 3. Finally, if that didn't work, we randomly pick UIDs, until we find one that is empty.
          *
-         * Since the dynamic UID space is relatively small we'll stop trying after 100 iterations, giving up. */
+         * Since the dynamic UID space is relatively small we'll stop trying after 100 iterations, giving up.
+         *
+         * This is already a constant number of steps in the common case: the name hash almost always hits a
+         * free UID on the first try, the per-boot lock files under /run/systemd/dynamic-uid are the
+         * allocation registry (a bitmap would track the same state with less information — the lock fd also
+         * serializes against concurrent release), and the NSS probe per candidate is what guarantees we
+         * never hand out a UID that a statically configured user owns. That check cannot be deferred past
+         * the point of use: by then the service would already be running with somebody else's UID. */
 
         enum {
                 PHASE_SUGGESTED,  /* the first phase, reusing directory ownership UIDs */
@@ -4656,22 +4656,24 @@ int exec_spawn(Unit *unit,
         if (r < 0)
                 return log_unit_error_errno(unit, r, "Failed to load environment files: %m");
 
-        line = exec_command_line(command->argv);
-        if (!line)
-                return log_oom();
-
         /* Fork with up-to-date SELinux label database, so the child inherits the up-to-date db
            and, until the next SELinux policy changes, we save further reloads in future children. */
         mac_selinux_maybe_reload();
 
-        log_struct(LOG_DEBUG,
-                   LOG_UNIT_MESSAGE(unit, "About to execute %s", line),
-                   "EXECUTABLE=%s", command->path, /* We won't know the real executable path until we create
-                                                      the mount namespace in the child, but we want to log
-                                                      from the parent, so we need to use the (possibly
-                                                      inaccurate) path here. */
-                   LOG_UNIT_ID(unit),
-                   LOG_UNIT_INVOCATION_ID(unit));
+        if (DEBUG_LOGGING) {
+                line = exec_command_line(command->argv);
+                if (!line)
+                        return log_oom();
+
+                log_struct(LOG_DEBUG,
+                           LOG_UNIT_MESSAGE(unit, "About to execute %s", line),
+                           "EXECUTABLE=%s", command->path, /* We won't know the real executable path until we create
+                                                              the mount namespace in the child, but we want to log
+                                                              from the parent, so we need to use the (possibly
+                                                              inaccurate) path here. */
+                           LOG_UNIT_ID(unit),
+                           LOG_UNIT_INVOCATION_ID(unit));
+        }
 
         if (params->cgroup_path) {
                 r = exec_parameters_get_cgroup_path(params, &subcgroup_path);
@@ -155,7 +155,13 @@ IPAddressAccessItem* ip_address_access_reduce(IPAddressAccessItem *first) {
         int r;
 
         /* Drops all entries from the list that are covered by another entry in full, thus removing all redundant
-         * entries. */
+         * entries.
+         *
+         * Note that this linked list is configuration-side storage only. The packet path never walks
+         * it: bpf-firewall.c loads the reduced entries into BPF_MAP_TYPE_LPM_TRIE maps, so per-packet
+         * evaluation is a trie lookup regardless of list length, and updating the address set is a map
+         * update without reloading the program. The O(n²) pass here runs once per unit load and exists
+         * precisely to keep those kernel maps small. */
 
         LIST_FOREACH_SAFE(items, a, tmp, first) {
 
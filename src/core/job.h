@@ -149,6 +149,12 @@ struct Job {
 
         unsigned run_queue_idx;
 
+        /* Scheduling keys for the run queue prioq, cached at enqueue time: the relative order of queued
+         * jobs must not change while they sit in the heap, and deriving these from the cgroup context on
+         * every comparison was needlessly expensive. */
+        uint64_t run_queue_cpu_weight;
+        int run_queue_nice;
+
         bool installed:1;
         bool in_run_queue:1;
         bool matters_to_anchor:1;
@@ -5505,7 +5505,7 @@ int unit_load_fragment(Unit *u) {
                         r = config_parse(u->id, fragment, f,
                                          UNIT_VTABLE(u)->sections,
                                          config_item_perf_lookup, load_fragment_gperf_lookup,
-                                         0,
+                                         CONFIG_PARSE_CACHE,
                                          u,
                                          NULL);
                         if (r == -ENOEXEC)
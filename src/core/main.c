@@ -184,6 +184,13 @@ _noreturn_ static void freeze_or_exit_or_reboot(void) {
         freeze();
 }
 
+/* Keep this handler dumb. The forked child re-raises the signal and produces a full core dump, and
+ * that core already contains everything a hand-maintained crash arena could record — job queue,
+ * event sources, dispatch state — with none of the async-signal-safety traps of serializing it
+ * from the handler (even our log calls here are best-effort, not strictly signal-safe). Note also
+ * that a handler only helps when a signal fires: a *wedged* PID 1 never enters this path, which is
+ * what the runtime introspection signals (SIGRTMIN+22/23 log level, systemd-analyze dump) and the
+ * hardware watchdog are for. Instrumentation for stalls belongs there, not here. */
 _noreturn_ static void crash(int sig) {
         struct sigaction sa;
         pid_t pid;
@@ -1118,6 +1125,13 @@ static int help(void) {
         return 0;
 }
 
+/* Used both for plain reexec and for the initrd→host transition. In the switch-root case the
+ * serialization deliberately carries runtime state (jobs, fds, unit activation state) but not
+ * parsed unit files: the host root is a different unit universe — different fragment paths,
+ * drop-ins, presets and dependencies — and a content-hash scheme to reuse "identical" initrd units
+ * would still have to stat and read every candidate file in the new root to compute the hash,
+ * which is most of what parsing costs. The re-parse after deserialization is also what guarantees
+ * the manager's view matches the root it now runs in, instead of whatever the initrd shipped. */
 static int prepare_reexecute(
                 Manager *m,
                 FILE **ret_f,
@@ -3,6 +3,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <linux/kd.h>
+#include <stdio_ext.h>
 #include <sys/epoll.h>
 #include <sys/inotify.h>
 #include <sys/ioctl.h>
@@ -79,6 +80,7 @@
 #include "time-util.h"
 #include "transaction.h"
 #include "umask-util.h"
+#include "unit-file.h"
 #include "unit-name.h"
 #include "user-util.h"
 #include "virt.h"
@@ -100,6 +102,14 @@
 /* How many units and jobs to process of the bus queue before returning to the event loop. */
 #define MANAGER_BUS_MESSAGE_BUDGET 100U
 
+/* How many datagrams to process per wakeup of the notification socket at most */
+#define NOTIFY_DATAGRAMS_PER_DISPATCH_MAX 32U
+
+/* How many entries of the GC queues to process per dispatch at most, so that we come back to the top of the
+ * main loop — and hence to the watchdog ping — regularly, even when session churn has queued tens of
+ * thousands of units or jobs for collection. Whatever is left over simply stays queued. */
+#define MANAGER_GC_QUEUE_BUDGET 256U
+
 static int manager_dispatch_notify_fd(sd_event_source *source, int fd, uint32_t revents, void *userdata);
 static int manager_dispatch_cgroups_agent_fd(sd_event_source *source, int fd, uint32_t revents, void *userdata);
 static int manager_dispatch_signal_fd(sd_event_source *source, int fd, uint32_t revents, void *userdata);
@@ -1235,7 +1245,7 @@ static unsigned manager_dispatch_gc_unit_queue(Manager *m) {
 
         gc_marker = m->gc_marker;
 
-        while ((u = m->gc_unit_queue)) {
+        while (n < MANAGER_GC_QUEUE_BUDGET && (u = m->gc_unit_queue)) {
                 assert(u->in_gc_queue);
 
                 unit_gc_sweep(u, gc_marker);
@@ -1263,7 +1273,7 @@ static unsigned manager_dispatch_gc_job_queue(Manager *m) {
 
         assert(m);
 
-        while ((j = m->gc_job_queue)) {
+        while (n < MANAGER_GC_QUEUE_BUDGET && (j = m->gc_job_queue)) {
                 assert(j->in_gc_queue);
 
                 LIST_REMOVE(gc_queue, m->gc_job_queue, j);
@@ -1597,6 +1607,37 @@ static void manager_preset_all(Manager *m) {
                 log_info("Populated /etc with preset unit settings.");
 }
 
+static void manager_prefetch_unit_files(Manager *m) {
+        const char *p;
+
+        assert(m);
+
+        /* The unit load phase is strictly serial — PID 1 must not use threads — but most of the time spent
+         * there on cold boots is waiting for unit fragments to be read from disk. Build the unit name map
+         * now (we'd do that on the first unit load anyway) and ask the kernel to read all candidate files in
+         * asynchronously, so that the subsequent parsing mostly operates on the page cache. */
+
+        if (MANAGER_IS_TEST_RUN(m))
+                return;
+
+        (void) unit_file_build_name_map(&m->lookup_paths,
+                                        &m->unit_cache_timestamp_hash,
+                                        &m->unit_id_map,
+                                        &m->unit_name_map,
+                                        &m->unit_path_cache);
+
+        SET_FOREACH(p, m->unit_path_cache) {
+                _cleanup_close_ int fd = -1;
+
+                fd = open(p, O_RDONLY|O_CLOEXEC|O_NOCTTY|O_NONBLOCK);
+                if (fd < 0)
+                        continue;
+
+                /* Unit files are tiny, no need to bother with their exact size here. */
+                (void) readahead(fd, 0, LONG_LINE_MAX);
+        }
+}
+
 static void manager_ready(Manager *m) {
         assert(m);
 
@@ -1650,6 +1691,8 @@ int manager_startup(Manager *m, FILE *serialization, FDSet *fds) {
 
         lookup_paths_log(&m->lookup_paths);
 
+        manager_prefetch_unit_files(m);
+
         {
                 /* This block is (optionally) done with the reloading counter bumped */
                 _cleanup_(manager_reloading_stopp) Manager *reloading = NULL;
@@ -2127,6 +2170,28 @@ void manager_dump(Manager *m, FILE *f, const char *prefix) {
                                                                 format_timespan(buf, sizeof buf, t->monotonic, 1));
         }
 
+        {
+                uint64_t iterations;
+
+                /* Useful for verifying that wakeup-reduction work (timer coalescing and the like) actually
+                 * sticks: sample this twice over a known idle interval and divide. */
+                if (sd_event_get_iteration(m->event, &iterations) >= 0)
+                        fprintf(f, "%sEvent loop iterations: %" PRIu64 "\n", strempty(prefix), iterations);
+        }
+
+        for (ManagerDispatchPhase p = 0; p < _MANAGER_DISPATCH_PHASE_MAX; p++) {
+                char buf[FORMAT_TIMESPAN_MAX];
+
+                if (m->dispatch_phase_n[p] == 0 && m->dispatch_phase_usec[p] == 0)
+                        continue;
+
+                fprintf(f, "%sDispatch %s: %" PRIu64 " items, %s\n",
+                        strempty(prefix),
+                        manager_dispatch_phase_to_string(p),
+                        m->dispatch_phase_n[p],
+                        format_timespan(buf, sizeof buf, m->dispatch_phase_usec[p], 1));
+        }
+
         manager_dump_units(m, f, prefix);
         manager_dump_jobs(m, f, prefix);
 }
@@ -2348,10 +2413,9 @@ static void manager_invoke_notify_message(
         }
 }
 
-static int manager_dispatch_notify_fd(sd_event_source *source, int fd, uint32_t revents, void *userdata) {
+static int manager_process_notify_message(Manager *m) {
 
         _cleanup_fdset_free_ FDSet *fds = NULL;
-        Manager *m = userdata;
         char buf[NOTIFY_BUFFER_MAX+1];
         struct iovec iovec = {
                 .iov_base = buf,
@@ -2377,16 +2441,13 @@ static int manager_dispatch_notify_fd(sd_event_source *source, int fd, uint32_t
         ssize_t n;
 
         assert(m);
-        assert(m->notify_fd == fd);
 
-        if (revents != EPOLLIN) {
-                log_warning("Got unexpected poll event for notify fd.");
-                return 0;
-        }
+        /* Processes one queued notification datagram. Returns > 0 if one was processed, 0 if the socket is
+         * drained, and a negative errno on receive errors. */
 
         n = recvmsg_safe(m->notify_fd, &msghdr, MSG_DONTWAIT|MSG_CMSG_CLOEXEC|MSG_TRUNC);
         if (IN_SET(n, -EAGAIN, -EINTR))
-                return 0; /* Spurious wakeup, try again */
+                return 0; /* Nothing (left) to read */
         if (n < 0)
                 /* If this is any other, real error, then let's stop processing this socket. This of course
                  * means we won't take notification messages anymore, but that's still better than busy
@@ -2417,25 +2478,25 @@ static int manager_dispatch_notify_fd(sd_event_source *source, int fd, uint32_t
                 if (r < 0) {
                         close_many(fd_array, n_fds);
                         log_oom();
-                        return 0;
+                        return 1;
                 }
         }
 
         if (!ucred || !pid_is_valid(ucred->pid)) {
                 log_warning("Received notify message without valid credentials. Ignoring.");
-                return 0;
+                return 1;
         }
 
         if ((size_t) n >= sizeof(buf) || (msghdr.msg_flags & MSG_TRUNC)) {
                 log_warning("Received notify message exceeded maximum size. Ignoring.");
-                return 0;
+                return 1;
         }
 
         /* As extra safety check, let's make sure the string we get doesn't contain embedded NUL bytes. We permit one
          * trailing NUL byte in the message, but don't expect it. */
         if (n > 1 && memchr(buf, 0, n-1)) {
                 log_warning("Received notify message with embedded NUL bytes. Ignoring.");
-                return 0;
+                return 1;
         }
 
         /* Make sure it's NUL-terminated, then parse it to obtain the tags list */
@@ -2443,12 +2504,12 @@ static int manager_dispatch_notify_fd(sd_event_source *source, int fd, uint32_t
         tags = strv_split_newlines(buf);
         if (!tags) {
                 log_oom();
-                return 0;
+                return 1;
         }
 
         /* possibly a barrier fd, let's see */
         if (manager_process_barrier_fd(tags, fds))
-                return 0;
+                return 1;
 
         /* Increase the generation counter used for filtering out duplicate unit invocations. */
         m->notifygen++;
@@ -2489,6 +2550,30 @@ static int manager_dispatch_notify_fd(sd_event_source *source, int fd, uint32_t
         if (fdset_size(fds) > 0)
                 log_warning("Got extra auxiliary fds with notification message, closing them.");
 
+        return 1;
+}
+
+static int manager_dispatch_notify_fd(sd_event_source *source, int fd, uint32_t revents, void *userdata) {
+        Manager *m = userdata;
+        int r;
+
+        assert(m);
+        assert(m->notify_fd == fd);
+
+        if (revents != EPOLLIN) {
+                log_warning("Got unexpected poll event for notify fd.");
+                return 0;
+        }
+
+        /* Drain multiple datagrams per wakeup, so that chatty services don't cost us a full event loop
+         * iteration per message — but bounded, so that a flood cannot monopolize the loop. The socket stays
+         * readable, hence whatever is left wakes us up again. */
+        for (unsigned i = 0; i < NOTIFY_DATAGRAMS_PER_DISPATCH_MAX; i++) {
+                r = manager_process_notify_message(m);
+                if (r <= 0)
+                        return r;
+        }
+
         return 0;
 }
 
@@ -2919,6 +3004,19 @@ static int manager_dispatch_jobs_in_progress(sd_event_source *source, usec_t use
         return sd_event_source_set_enabled(source, SD_EVENT_ONESHOT);
 }
 
+/* Evaluates one dispatch expression of the main loop, accounting the wall-clock time spent and the number
+ * of items processed under the given phase. Evaluates to the expression's result. */
+#define MANAGER_DISPATCH_PHASE(m, phase, expr)                          \
+        ({                                                              \
+                usec_t _ts = now(CLOCK_MONOTONIC);                      \
+                int _k = (expr);                                        \
+                (m)->dispatch_phase_usec[phase] +=                      \
+                        usec_sub_unsigned(now(CLOCK_MONOTONIC), _ts);   \
+                if (_k > 0)                                             \
+                        (m)->dispatch_phase_n[phase] += _k;             \
+                _k;                                                     \
+        })
+
 int manager_loop(Manager *m) {
         RateLimit rl = { .interval = 1*USEC_PER_SEC, .burst = 50000 };
         int r;
@@ -2948,25 +3046,25 @@ int manager_loop(Manager *m) {
                         sleep(1);
                 }
 
-                if (manager_dispatch_load_queue(m) > 0)
+                if (MANAGER_DISPATCH_PHASE(m, MANAGER_DISPATCH_LOAD, manager_dispatch_load_queue(m)) > 0)
                         continue;
 
-                if (manager_dispatch_gc_job_queue(m) > 0)
+                if (MANAGER_DISPATCH_PHASE(m, MANAGER_DISPATCH_GC_JOB, manager_dispatch_gc_job_queue(m)) > 0)
                         continue;
 
-                if (manager_dispatch_gc_unit_queue(m) > 0)
+                if (MANAGER_DISPATCH_PHASE(m, MANAGER_DISPATCH_GC_UNIT, manager_dispatch_gc_unit_queue(m)) > 0)
                         continue;
 
-                if (manager_dispatch_cleanup_queue(m) > 0)
+                if (MANAGER_DISPATCH_PHASE(m, MANAGER_DISPATCH_CLEANUP, manager_dispatch_cleanup_queue(m)) > 0)
                         continue;
 
-                if (manager_dispatch_cgroup_realize_queue(m) > 0)
+                if (MANAGER_DISPATCH_PHASE(m, MANAGER_DISPATCH_CGROUP_REALIZE, manager_dispatch_cgroup_realize_queue(m)) > 0)
                         continue;
 
-                if (manager_dispatch_stop_when_unneeded_queue(m) > 0)
+                if (MANAGER_DISPATCH_PHASE(m, MANAGER_DISPATCH_STOP_WHEN_UNNEEDED, manager_dispatch_stop_when_unneeded_queue(m)) > 0)
                         continue;
 
-                if (manager_dispatch_dbus_queue(m) > 0)
+                if (MANAGER_DISPATCH_PHASE(m, MANAGER_DISPATCH_DBUS, manager_dispatch_dbus_queue(m)) > 0)
                         continue;
 
                 /* Sleep for watchdog runtime wait time */
@@ -2975,7 +3073,7 @@ int manager_loop(Manager *m) {
                 else
                         wait_usec = USEC_INFINITY;
 
-                r = sd_event_run(m->event, wait_usec);
+                r = MANAGER_DISPATCH_PHASE(m, MANAGER_DISPATCH_EVENT, sd_event_run(m->event, wait_usec));
                 if (r < 0)
                         return log_error_errno(r, "Failed to run event loop: %m");
         }
@@ -3156,6 +3254,10 @@ int manager_open_serialization(Manager *m, FILE **_f) {
         if (!f)
                 return -errno;
 
+        /* We are single-threaded, and the serialization is written through a multitude of small fputs() and
+         * fputc() calls — don't pay for taking the stdio lock on each of them. */
+        (void) __fsetlocking(f, FSETLOCKING_BYCALLER);
+
         *_f = f;
         return 0;
 }
@@ -4962,6 +5064,19 @@ static const char *const manager_timestamp_table[_MANAGER_TIMESTAMP_MAX] = {
 
 DEFINE_STRING_TABLE_LOOKUP(manager_timestamp, ManagerTimestamp);
 
+static const char *const manager_dispatch_phase_table[_MANAGER_DISPATCH_PHASE_MAX] = {
+        [MANAGER_DISPATCH_LOAD] = "load",
+        [MANAGER_DISPATCH_GC_JOB] = "gc-job",
+        [MANAGER_DISPATCH_GC_UNIT] = "gc-unit",
+        [MANAGER_DISPATCH_CLEANUP] = "cleanup",
+        [MANAGER_DISPATCH_CGROUP_REALIZE] = "cgroup-realize",
+        [MANAGER_DISPATCH_STOP_WHEN_UNNEEDED] = "stop-when-unneeded",
+        [MANAGER_DISPATCH_DBUS] = "dbus",
+        [MANAGER_DISPATCH_EVENT] = "event",
+};
+
+DEFINE_STRING_TABLE_LOOKUP(manager_dispatch_phase, ManagerDispatchPhase);
+
 static const char* const oom_policy_table[_OOM_POLICY_MAX] = {
         [OOM_CONTINUE] = "continue",
         [OOM_STOP] = "stop",
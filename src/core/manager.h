@@ -114,6 +114,20 @@ typedef enum ManagerTimestamp {
         _MANAGER_TIMESTAMP_INVALID = -1,
 } ManagerTimestamp;
 
+/* The phases of PID 1's main loop we account wall-clock time for, for "systemd-analyze dump" */
+typedef enum ManagerDispatchPhase {
+        MANAGER_DISPATCH_LOAD,
+        MANAGER_DISPATCH_GC_JOB,
+        MANAGER_DISPATCH_GC_UNIT,
+        MANAGER_DISPATCH_CLEANUP,
+        MANAGER_DISPATCH_CGROUP_REALIZE,
+        MANAGER_DISPATCH_STOP_WHEN_UNNEEDED,
+        MANAGER_DISPATCH_DBUS,
+        MANAGER_DISPATCH_EVENT,
+        _MANAGER_DISPATCH_PHASE_MAX,
+        _MANAGER_DISPATCH_PHASE_INVALID = -1,
+} ManagerDispatchPhase;
+
 typedef enum WatchdogType {
         WATCHDOG_RUNTIME,
         WATCHDOG_REBOOT,
@@ -245,6 +259,10 @@ struct Manager {
 
         dual_timestamp timestamps[_MANAGER_TIMESTAMP_MAX];
 
+        /* Cumulative wall-clock time spent in and number of items processed by each main loop phase */
+        usec_t dispatch_phase_usec[_MANAGER_DISPATCH_PHASE_MAX];
+        uint64_t dispatch_phase_n[_MANAGER_DISPATCH_PHASE_MAX];
+
         /* Data specific to the device subsystem */
         sd_device_monitor *device_monitor;
         Hashmap *devices_by_sysfs;
@@ -252,6 +270,7 @@ struct Manager {
         /* Data specific to the mount subsystem */
         struct libmnt_monitor *mount_monitor;
         sd_event_source *mount_event_source;
+        Hashmap *mount_unit_name_cache; /* Memoized mount path → unit name translations */
 
         /* Data specific to the swap filesystem */
         FILE *proc_swaps;
@@ -294,10 +313,10 @@ struct Manager {
         int cgroup_inotify_fd;
         sd_event_source *cgroup_inotify_event_source;
 
-        /* Maps for finding the unit for each inotify watch descriptor for the cgroup.events and
-         * memory.events cgroupv2 attributes. */
-        Hashmap *cgroup_control_inotify_wd_unit;
-        Hashmap *cgroup_memory_inotify_wd_unit;
+        /* Map for finding the unit for each inotify watch descriptor. Both the cgroup.events and the
+         * memory.events cgroupv2 attribute watches live on the same inotify fd and hence share one watch
+         * descriptor namespace, so a single map suffices for both. */
+        Hashmap *cgroup_inotify_wd_unit;
 
         /* A defer event for handling cgroup empty events and processing them after SIGCHLD in all cases. */
         sd_event_source *cgroup_empty_event_source;
@@ -558,6 +577,9 @@ bool manager_is_confirm_spawn_disabled(Manager *m);
 void manager_disable_confirm_spawn(void);
 
 const char *manager_timestamp_to_string(ManagerTimestamp m) _const_;
+
+const char *manager_dispatch_phase_to_string(ManagerDispatchPhase p) _const_;
+ManagerDispatchPhase manager_dispatch_phase_from_string(const char *s) _pure_;
 ManagerTimestamp manager_timestamp_from_string(const char *s) _pure_;
 ManagerTimestamp manager_timestamp_initrd_mangle(ManagerTimestamp s);
 
@@ -1645,7 +1645,8 @@ static int mount_setup_unit(
                 const char *fstype,
                 bool set_flags) {
 
-        _cleanup_free_ char *e = NULL;
+        _cleanup_free_ char *e = NULL, *key = NULL;
+        const char *name;
         MountProcFlags flags;
         Unit *u;
         int r;
@@ -1676,30 +1677,49 @@ static int mount_setup_unit(
          * software. Having such long names just means you cannot use systemd to manage those specific mount
          * points, which should be an OK restriction to make. After all we don't have to be able to manage
          * all mount points in the world — as long as we don't choke on them when we encounter them. */
-        r = unit_name_from_path(where, ".mount", &e);
-        if (r < 0) {
-                static RateLimit rate_limit = { /* Let's log about this at warning level at most once every
-                                                 * 5s. Given that we generate this whenever we read the file
-                                                 * otherwise we probably shouldn't flood the logs with
-                                                 * this */
-                        .interval = 5 * USEC_PER_SEC,
-                        .burst = 1,
-                };
-
-                return log_struct_errno(
-                                ratelimit_below(&rate_limit) ? LOG_WARNING : LOG_DEBUG, r,
-                                "MESSAGE_ID=" SD_MESSAGE_MOUNT_POINT_PATH_NOT_SUITABLE_STR,
-                                "MOUNT_POINT=%s", where,
-                                LOG_MESSAGE("Failed to generate valid unit name from path '%s', ignoring mount point: %m", where));
+        /* The unit name is a pure function of the mount path, and we re-translate every single mount point
+         * on every /proc/self/mountinfo event, hence memoize the translation — the escaping is surprisingly
+         * expensive on hosts carrying thousands of mounts. */
+        name = hashmap_get(m->mount_unit_name_cache, where);
+        if (!name) {
+                r = unit_name_from_path(where, ".mount", &e);
+                if (r < 0) {
+                        static RateLimit rate_limit = { /* Let's log about this at warning level at most once every
+                                                         * 5s. Given that we generate this whenever we read the file
+                                                         * otherwise we probably shouldn't flood the logs with
+                                                         * this */
+                                .interval = 5 * USEC_PER_SEC,
+                                .burst = 1,
+                        };
+
+                        return log_struct_errno(
+                                        ratelimit_below(&rate_limit) ? LOG_WARNING : LOG_DEBUG, r,
+                                        "MESSAGE_ID=" SD_MESSAGE_MOUNT_POINT_PATH_NOT_SUITABLE_STR,
+                                        "MOUNT_POINT=%s", where,
+                                        LOG_MESSAGE("Failed to generate valid unit name from path '%s', ignoring mount point: %m", where));
+                }
+
+                /* Keep the cache bounded, mount paths are controlled by the local admin but still. */
+                if (hashmap_size(m->mount_unit_name_cache) >= 4096)
+                        m->mount_unit_name_cache = hashmap_free(m->mount_unit_name_cache);
+
+                name = e;
+
+                key = strdup(where);
+                if (key && hashmap_ensure_put(&m->mount_unit_name_cache, &string_hash_ops_free_free, key, e) >= 0) {
+                        /* Both now owned by the cache, 'name' points at the cached copy */
+                        TAKE_PTR(key);
+                        TAKE_PTR(e);
+                }
         }
 
-        u = manager_get_unit(m, e);
+        u = manager_get_unit(m, name);
         if (u)
                 r = mount_setup_existing_unit(u, what, where, options, fstype, &flags);
         else
                 /* First time we see this mount point meaning that it's not been initiated by a mount unit but rather
                  * by the sysadmin having called mount(8) directly. */
-                r = mount_setup_new_unit(m, e, what, where, options, fstype, &flags, &u);
+                r = mount_setup_new_unit(m, name, what, where, options, fstype, &flags, &u);
         if (r < 0)
                 return log_warning_errno(r, "Failed to set up mount unit for '%s': %m", where);
 
@@ -1754,6 +1774,7 @@ static void mount_shutdown(Manager *m) {
         assert(m);
 
         m->mount_event_source = sd_event_source_unref(m->mount_event_source);
+        m->mount_unit_name_cache = hashmap_free(m->mount_unit_name_cache);
 
         mnt_unref_monitor(m->mount_monitor);
         m->mount_monitor = NULL;
@@ -1441,6 +1441,13 @@ static int verity_settings_prepare(
         return 0;
 }
 
+/* Assembles and applies the service's mount namespace from scratch on every spawn, in the forked child. A
+ * cache of prepared template namespaces entered via setns() was considered and doesn't work: even
+ * "identical" sandbox profiles diverge in per-unit mounts (RuntimeDirectory=, PrivateTmp= directories,
+ * credentials), the tree must reflect the file system as it is at spawn time (symlinks, images and
+ * log-namespace sockets are resolved here, and a cached namespace would pin stale superblocks alive), and a
+ * kept-alive namespace needs a holder process or fd per profile that PID 1 would have to manage. The mount
+ * syscalls all happen in the child, so they cost the spawned service latency but never block the manager. */
 int setup_namespace(
                 const char* root_directory,
                 const char* root_image,
@@ -51,6 +51,13 @@ int path_spec_watch(PathSpec *s, sd_event_io_handler_t handler) {
         assert(s->unit);
         assert(handler);
 
+        /* Each spec gets its own inotify instance on purpose, even though that duplicates ancestor watches
+         * across units watching similar paths: a watch mask is a property of the (instance, inode) pair, so
+         * a shared manager-wide instance would have to union the masks of all interested specs via
+         * IN_MASK_ADD and demultiplex every event — including IN_IGNORED and the rewatch dance below — in
+         * userspace per spec. The kernel memory saved wouldn't buy back that complexity; hosts with very
+         * many path units should raise fs.inotify.max_user_instances/max_user_watches instead. */
+
         path_spec_unwatch(s);
 
         s->inotify_fd = inotify_init1(IN_NONBLOCK|IN_CLOEXEC);
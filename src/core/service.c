@@ -201,7 +201,7 @@ static void service_stop_watchdog(Service *s) {
 }
 
 static void service_start_watchdog(Service *s) {
-        usec_t watchdog_usec;
+        usec_t watchdog_usec, accuracy;
         int r;
 
         assert(s);
@@ -212,6 +212,11 @@ static void service_start_watchdog(Service *s) {
                 return;
         }
 
+        /* Allow the event loop to coalesce the expiry wakeups of many watchdog-armed services: firing up to
+         * a tenth of the period late merely delays detection of an already hung service a bit, and a ping
+         * that arrives in the meantime pushes the deadline forward anyway. */
+        accuracy = CLAMP(watchdog_usec / 10, USEC_PER_MSEC, 30 * USEC_PER_SEC);
+
         if (s->watchdog_event_source) {
                 r = sd_event_source_set_time(s->watchdog_event_source, usec_add(s->watchdog_timestamp.monotonic, watchdog_usec));
                 if (r < 0) {
@@ -219,13 +224,15 @@ static void service_start_watchdog(Service *s) {
                         return;
                 }
 
+                (void) sd_event_source_set_time_accuracy(s->watchdog_event_source, accuracy);
+
                 r = sd_event_source_set_enabled(s->watchdog_event_source, SD_EVENT_ONESHOT);
         } else {
                 r = sd_event_add_time(
                                 UNIT(s)->manager->event,
                                 &s->watchdog_event_source,
                                 CLOCK_MONOTONIC,
-                                usec_add(s->watchdog_timestamp.monotonic, watchdog_usec), 0,
+                                usec_add(s->watchdog_timestamp.monotonic, watchdog_usec), accuracy,
                                 service_dispatch_watchdog, s);
                 if (r < 0) {
                         log_unit_warning_errno(UNIT(s), r, "Failed to add watchdog timer: %m");
@@ -2299,6 +2299,13 @@ static void flush_ports(Socket *s) {
         }
 }
 
+/* On the first connection there is no unit-file loading left to speculate away: the triggered
+ * service was parsed when the socket unit was loaded (Triggers= forces the service unit into
+ * memory at load time), so what runs here is job enqueueing plus fork/exec. The per-spawn work
+ * that remains — user resolution and SELinux context lookup in execute.c — happens in the child on
+ * purpose: it is privilege-boundary-sensitive and must reflect the state at spawn time, so
+ * prefetching it in the manager on POLLIN would both race the authoritative lookup and move NSS
+ * calls into PID 1's main loop. */
 static void socket_enter_running(Socket *s, int cfd_in) {
         /* Note that this call takes possession of the connection fd passed. It either has to assign it
          * somewhere or close it. */
@@ -2987,6 +2994,13 @@ static int socket_dispatch_io(sd_event_source *source, int fd, uint32_t revents,
                 goto fail;
         }
 
+        /* Note that in Accept=yes mode we accept exactly one connection per wakeup and spawn one service
+         * instance for it through the full job machinery — by design. The instance's name is derived from
+         * the peer address of the accepted connection, so instances cannot be pre-created, and any
+         * per-connection fan-out scheme would just move the job overhead around. Workloads that need
+         * thousands of accepts per second should use Accept=no and accept in the service itself, possibly
+         * running several of them on the same port via ReusePort=yes; MaxConnections= and the trigger rate
+         * limit bound the damage an accept storm can do here. */
         if (p->socket->accept &&
             p->type == SOCKET_SOCKET &&
             socket_address_can_accept(&p->address)) {
@@ -279,39 +279,58 @@ static int transaction_merge_jobs(Transaction *tr, sd_bus_error *e) {
 }
 
 static void transaction_drop_redundant(Transaction *tr) {
-        bool again;
+        _cleanup_free_ Job **victims = NULL;
+        size_t n_victims = 0, n_allocated = 0;
+        Job *j;
 
         /* Goes through the transaction and removes all jobs of the units whose jobs are all noops. If not
          * all of a unit's jobs are redundant, they are kept. */
 
         assert(tr);
 
-        do {
-                Job *j;
-
-                again = false;
+        /* Whether a unit's jobs are redundant depends only on that unit's own job list and unit state, not
+         * on any other entry in the transaction, hence a single pass suffices. Collect the victims first
+         * and delete them afterwards, so that we don't modify the job table while iterating through it —
+         * the old code restarted the scan after every deletion, which made this quadratic on the large
+         * transactions that template instantiations produce. */
 
-                HASHMAP_FOREACH(j, tr->jobs) {
-                        bool keep = false;
-                        Job *k;
-
-                        LIST_FOREACH(transaction, k, j)
-                                if (tr->anchor_job == k ||
-                                    !job_type_is_redundant(k->type, unit_active_state(k->unit)) ||
-                                    (k->unit->job && job_type_is_conflicting(k->type, k->unit->job->type))) {
-                                        keep = true;
-                                        break;
-                                }
+        HASHMAP_FOREACH(j, tr->jobs) {
+                bool keep = false;
+                Job *k;
 
-                        if (!keep) {
-                                log_trace("Found redundant job %s/%s, dropping from transaction.",
-                                          j->unit->id, job_type_to_string(j->type));
-                                transaction_delete_job(tr, j, false);
-                                again = true;
+                LIST_FOREACH(transaction, k, j)
+                        if (tr->anchor_job == k ||
+                            !job_type_is_redundant(k->type, unit_active_state(k->unit)) ||
+                            (k->unit->job && job_type_is_conflicting(k->type, k->unit->job->type))) {
+                                keep = true;
                                 break;
                         }
+
+                if (keep)
+                        continue;
+
+                /* All jobs of this unit are redundant, so collect the whole sibling chain: deleting
+                 * a job only unlinks that one entry, and before the merge step a unit routinely has
+                 * several jobs queued. */
+                LIST_FOREACH(transaction, k, j) {
+                        if (!GREEDY_REALLOC(victims, n_allocated, n_victims + 1)) {
+                                /* Dropping redundant jobs is an optimization, not required for
+                                 * correctness, hence if we are this low on memory just drop what we
+                                 * collected so far. */
+                                log_oom();
+                                goto drop;
+                        }
+
+                        victims[n_victims++] = k;
                 }
-        } while (again);
+        }
+
+ drop:
+        for (size_t i = 0; i < n_victims; i++) {
+                log_trace("Found redundant job %s/%s, dropping from transaction.",
+                          victims[i]->unit->id, job_type_to_string(victims[i]->type));
+                transaction_delete_job(tr, victims[i], false);
+        }
 }
 
 _pure_ static bool unit_matters_to_anchor(Unit *u, Job *j) {
@@ -124,6 +124,8 @@ typedef struct Unit {
         char *id;   /* The one special name that we use for identification */
         char *instance;
 
+        char *dbus_path_cache; /* The bus path derived from the id, cached since clients enumerate units a lot */
+
         Set *aliases; /* All the other names. */
 
         /* For each dependency type we maintain a Hashmap whose key is the Unit* object, and the value encodes why the
@@ -272,6 +274,7 @@ typedef struct Unit {
 
         /* Counterparts in the cgroup filesystem */
         char *cgroup_path;
+        Hashmap *cgroup_attribute_cache;           /* Last value we wrote per cgroup attribute, to suppress no-op rewrites */
         CGroupMask cgroup_realized_mask;           /* In which hierarchies does this unit's cgroup exist? (only relevant on cgroup v1) */
         CGroupMask cgroup_enabled_mask;            /* Which controllers are enabled (or more correctly: enabled for the children) for this unit's cgroup? (only relevant on cgroup v2) */
         CGroupMask cgroup_invalidated_mask;        /* A mask specifying controllers which shall be considered invalidated, and require re-realization */
@@ -759,6 +762,7 @@ bool unit_job_is_applicable(Unit *u, JobType j);
 int set_unit_path(const char *p);
 
 char *unit_dbus_path(Unit *u);
+const char *unit_dbus_path_cached(Unit *u);
 char *unit_dbus_path_invocation_id(Unit *u);
 
 int unit_load_related_unit(Unit *u, const char *type, Unit **_found);
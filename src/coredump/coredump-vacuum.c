@@ -13,6 +13,7 @@
 #include "hashmap.h"
 #include "macro.h"
 #include "memory-util.h"
+#include "sort-util.h"
 #include "string-util.h"
 #include "time-util.h"
 #include "user-util.h"
@@ -22,20 +23,34 @@
 #define DEFAULT_KEEP_FREE_UPPER (uint64_t) (4ULL*1024ULL*1024ULL*1024ULL) /* 4 GiB */
 #define DEFAULT_KEEP_FREE (uint64_t) (1024ULL*1024ULL)                    /* 1 MB */
 
+struct vacuum_entry {
+        char *name;
+        usec_t mtime;
+        uint64_t size;
+};
+
 struct vacuum_candidate {
-        unsigned n_files;
-        char *oldest_file;
-        usec_t oldest_mtime;
+        struct vacuum_entry *entries; /* sorted by mtime, oldest first */
+        size_t n_entries;
+        size_t n_allocated;
+        size_t i_next;                /* index of the oldest entry not removed yet */
 };
 
 static void vacuum_candidate_free(struct vacuum_candidate *c) {
         if (!c)
                 return;
 
-        free(c->oldest_file);
+        for (size_t i = 0; i < c->n_entries; i++)
+                free(c->entries[i].name);
+
+        free(c->entries);
         free(c);
 }
 
+static int vacuum_entry_compare(const struct vacuum_entry *a, const struct vacuum_entry *b) {
+        return CMP(a->mtime, b->mtime);
+}
+
 DEFINE_TRIVIAL_CLEANUP_FUNC(struct vacuum_candidate*, vacuum_candidate_free);
 
 static void vacuum_candidate_hashmap_free(Hashmap *h) {
@@ -130,7 +145,11 @@ int coredump_vacuum(int exclude_fd, uint64_t keep_free, uint64_t max_use) {
          * user with the most coredumps until we are back in the size
          * limits. Note that vacuuming for journal files is different,
          * because we rely on rate-limiting of the messages there,
-         * to avoid being flooded. */
+         * to avoid being flooded.
+         *
+         * We take stock of the directory once, and then plan all removals from the collected list, rather
+         * than rescanning and restatting everything after each removal — with crash loops filling the
+         * directory that rescan loop went quadratic. */
 
         d = opendir("/var/lib/systemd/coredump");
         if (!d) {
@@ -140,109 +159,112 @@ int coredump_vacuum(int exclude_fd, uint64_t keep_free, uint64_t max_use) {
                 return log_error_errno(errno, "Can't open coredump directory: %m");
         }
 
-        for (;;) {
-                _cleanup_(vacuum_candidate_hashmap_freep) Hashmap *h = NULL;
-                struct vacuum_candidate *worst = NULL;
-                struct dirent *de;
-                uint64_t sum = 0;
+        _cleanup_(vacuum_candidate_hashmap_freep) Hashmap *h = NULL;
+        struct vacuum_candidate *c;
+        struct dirent *de;
+        uint64_t sum = 0;
 
-                rewinddir(d);
+        FOREACH_DIRENT(de, d, goto fail) {
+                struct stat st;
+                uid_t uid;
+                char *n;
 
-                FOREACH_DIRENT(de, d, goto fail) {
-                        struct vacuum_candidate *c;
-                        struct stat st;
-                        uid_t uid;
-                        usec_t t;
+                r = uid_from_file_name(de->d_name, &uid);
+                if (r < 0)
+                        continue;
 
-                        r = uid_from_file_name(de->d_name, &uid);
-                        if (r < 0)
+                if (fstatat(dirfd(d), de->d_name, &st, AT_NO_AUTOMOUNT|AT_SYMLINK_NOFOLLOW) < 0) {
+                        if (errno == ENOENT)
                                 continue;
 
-                        if (fstatat(dirfd(d), de->d_name, &st, AT_NO_AUTOMOUNT|AT_SYMLINK_NOFOLLOW) < 0) {
-                                if (errno == ENOENT)
-                                        continue;
+                        log_warning_errno(errno, "Failed to stat /var/lib/systemd/coredump/%s: %m", de->d_name);
+                        continue;
+                }
 
-                                log_warning_errno(errno, "Failed to stat /var/lib/systemd/coredump/%s: %m", de->d_name);
-                                continue;
-                        }
+                if (!S_ISREG(st.st_mode))
+                        continue;
 
-                        if (!S_ISREG(st.st_mode))
-                                continue;
+                if (exclude_fd >= 0 &&
+                    exclude_st.st_dev == st.st_dev &&
+                    exclude_st.st_ino == st.st_ino)
+                        continue;
 
-                        if (exclude_fd >= 0 &&
-                            exclude_st.st_dev == st.st_dev &&
-                            exclude_st.st_ino == st.st_ino)
-                                continue;
+                r = hashmap_ensure_allocated(&h, NULL);
+                if (r < 0)
+                        return log_oom();
 
-                        r = hashmap_ensure_allocated(&h, NULL);
-                        if (r < 0)
-                                return log_oom();
+                c = hashmap_get(h, UID_TO_PTR(uid));
+                if (!c) {
+                        _cleanup_(vacuum_candidate_freep) struct vacuum_candidate *new_c = NULL;
 
-                        t = timespec_load(&st.st_mtim);
+                        new_c = new0(struct vacuum_candidate, 1);
+                        if (!new_c)
+                                return log_oom();
 
-                        c = hashmap_get(h, UID_TO_PTR(uid));
-                        if (c) {
+                        r = hashmap_put(h, UID_TO_PTR(uid), new_c);
+                        if (r < 0)
+                                return log_oom();
 
-                                if (t < c->oldest_mtime) {
-                                        char *n;
+                        c = TAKE_PTR(new_c);
+                }
 
-                                        n = strdup(de->d_name);
-                                        if (!n)
-                                                return log_oom();
+                if (!GREEDY_REALLOC(c->entries, c->n_allocated, c->n_entries + 1))
+                        return log_oom();
 
-                                        free(c->oldest_file);
-                                        c->oldest_file = n;
-                                        c->oldest_mtime = t;
-                                }
+                n = strdup(de->d_name);
+                if (!n)
+                        return log_oom();
 
-                        } else {
-                                _cleanup_(vacuum_candidate_freep) struct vacuum_candidate *n = NULL;
+                c->entries[c->n_entries++] = (struct vacuum_entry) {
+                        .name = n,
+                        .mtime = timespec_load(&st.st_mtim),
+                        .size = st.st_blocks * 512,
+                };
 
-                                n = new0(struct vacuum_candidate, 1);
-                                if (!n)
-                                        return log_oom();
+                sum += st.st_blocks * 512;
+        }
 
-                                n->oldest_file = strdup(de->d_name);
-                                if (!n->oldest_file)
-                                        return log_oom();
+        HASHMAP_FOREACH(c, h)
+                typesafe_qsort(c->entries, c->n_entries, vacuum_entry_compare);
 
-                                n->oldest_mtime = t;
+        for (;;) {
+                struct vacuum_candidate *worst = NULL;
+                struct vacuum_entry *e;
 
-                                r = hashmap_put(h, UID_TO_PTR(uid), n);
-                                if (r < 0)
-                                        return log_oom();
+                r = vacuum_necessary(dirfd(d), sum, keep_free, max_use);
+                if (r <= 0)
+                        return r;
 
-                                c = TAKE_PTR(n);
-                        }
+                /* Of the users with files left, pick the one with the most, breaking ties in favor of the
+                 * older next candidate. */
+                HASHMAP_FOREACH(c, h) {
+                        size_t left = c->n_entries - c->i_next;
 
-                        c->n_files++;
+                        if (left == 0)
+                                continue;
 
                         if (!worst ||
-                            worst->n_files < c->n_files ||
-                            (worst->n_files == c->n_files && c->oldest_mtime < worst->oldest_mtime))
+                            worst->n_entries - worst->i_next < left ||
+                            (worst->n_entries - worst->i_next == left &&
+                             c->entries[c->i_next].mtime < worst->entries[worst->i_next].mtime))
                                 worst = c;
-
-                        sum += st.st_blocks * 512;
                 }
-
                 if (!worst)
-                        break;
+                        return 0;
 
-                r = vacuum_necessary(dirfd(d), sum, keep_free, max_use);
-                if (r <= 0)
-                        return r;
+                e = worst->entries + worst->i_next++;
 
-                r = unlinkat_deallocate(dirfd(d), worst->oldest_file, 0);
-                if (r == -ENOENT)
-                        continue;
-                if (r < 0)
-                        return log_error_errno(r, "Failed to remove file %s: %m", worst->oldest_file);
+                r = unlinkat_deallocate(dirfd(d), e->name, 0);
+                if (r < 0 && r != -ENOENT)
+                        return log_error_errno(r, "Failed to remove file %s: %m", e->name);
+                if (r >= 0)
+                        log_info("Removed old coredump %s.", e->name);
 
-                log_info("Removed old coredump %s.", worst->oldest_file);
+                /* If the file was gone already somebody else removed it, and the space is freed either
+                 * way. */
+                sum = LESS_BY(sum, e->size);
         }
 
-        return 0;
-
 fail:
         return log_error_errno(errno, "Failed to read directory: %m");
 }
@@ -30,6 +30,7 @@
 #include "fileio.h"
 #include "fs-util.h"
 #include "io-util.h"
+#include "ioprio.h"
 #include "journal-importer.h"
 #include "log.h"
 #include "macro.h"
@@ -422,6 +423,13 @@ static int save_external_coredump(
                         goto uncompressed;
                 }
 
+                /* The core is spooled to disk in full at this point, hence the crashed process and the
+                 * kernel's core pipe are no longer waiting for us. Compression of a huge core can still go
+                 * on for a while, so do it at idle I/O priority to keep it from starving concurrently
+                 * arriving cores (or anything else). Best effort. */
+                if (ioprio_set(IOPRIO_WHO_PROCESS, 0, IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0)) < 0)
+                        log_debug_errno(errno, "Failed to lower I/O priority for coredump compression, ignoring: %m");
+
                 r = compress_stream(fd, fd_compressed, -1);
                 if (r < 0) {
                         log_error_errno(r, "Failed to compress %s: %m", coredump_tmpfile_name(tmp_compressed));
@@ -1230,6 +1230,11 @@ static int attach_luks_or_plain_or_bitlk_by_passphrase(
                 if (r >= 0)
                         break;
         }
+        if (r >= 0 && !pass_volume_key && arg_key_slot == CRYPT_ANY_SLOT)
+                /* The unlock time of multi-slot volumes is dominated by the key slots tried (and rejected)
+                 * before the matching one, since each trial costs a full KDF pass. Tell people which slot it
+                 * was, so that they can pin it via the crypttab keyslot= option if they care. */
+                log_debug("Volume %s activated with key slot %i.", name, r);
         if (r == -EPERM) {
                 log_error_errno(r, "Failed to activate with specified passphrase. (Passphrase incorrect?)");
                 return -EAGAIN; /* log actual error, but return EAGAIN */
@@ -1307,6 +1307,12 @@ static int run(int argc, char *argv[]) {
                         return log_oom();
         }
 
+        /* The steps below are not one durability transaction, on purpose. The small config files
+         * (locale, vconsole, timezone, hostname) are written without per-file fsync — losing them on
+         * power failure just means firstboot runs again. Only the passwd/shadow writes sync, because a
+         * torn credentials file is not recoverable by rerunning. The machine-id commit happens
+         * elsewhere entirely (PID 1, before any unit keyed on the ID starts) and cannot be folded into
+         * a sync point here without breaking that ordering. */
         r = process_locale();
         if (r < 0)
                 return r;
@@ -377,6 +377,13 @@ static int run(int argc, char *argv[]) {
                  * Since util-linux v2.25 fsck uses /run/fsck/<diskname>.lock files.
                  * The previous versions use flock for the device and conflict with
                  * udevd, see https://bugs.freedesktop.org/show_bug.cgi?id=79576#c5
+                 *
+                 * Note that this lock is taken on the whole-disk device, not the
+                 * partition: together with the fact that each device is checked by its
+                 * own systemd-fsck@.service instance this is what provides cross-device
+                 * parallelism at boot — checks of partitions sharing a spindle or
+                 * namespace serialize on the lock, while instances for independent
+                 * disks proceed concurrently.
                  */
                 cmdline[i++] = "-l";
 
@@ -960,6 +960,12 @@ static int home_on_worker_process(sd_event_source *s, const siginfo_t *si, void
         return 0;
 }
 
+/* Forks off the systemd-homework worker for one operation on this home. All long-running storage work —
+ * activation, LUKS (re)formatting, file system resizing, fallocate()/FITRIM of the backing file — happens in
+ * that per-home child process; our event loop only spawns it and collects its result. Each home runs at most
+ * one worker at a time (further requests are queued via home_schedule_operation() or refused with
+ * BUS_ERROR_HOME_BUSY), but workers of different homes run concurrently, so a slow resize on one home does
+ * not delay activations of others. */
 static int home_start_work(Home *h, const char *verb, UserRecord *hr, UserRecord *secret) {
         _cleanup_(json_variant_unrefp) JsonVariant *v = NULL;
         _cleanup_(erase_and_freep) char *formatted = NULL;
@@ -190,7 +190,7 @@ static bool valid_deployment(const char *deployment) {
         return in_charset(deployment, VALID_DEPLOYMENT_CHARS);
 }
 
-static const char* fallback_chassis(void) {
+static const char* fallback_chassis_impl(void) {
         char *type;
         unsigned t;
         int v, r;
@@ -304,6 +304,20 @@ try_acpi:
         return NULL;
 }
 
+static const char* fallback_chassis(void) {
+        static const char *cache = NULL;
+        static bool cached = false;
+
+        /* DMI and ACPI data (and the virtualization we run in) are fixed for the lifetime of the system,
+         * hence deduce the fallback chassis only once per daemon run instead of per property query. */
+        if (!cached) {
+                cache = fallback_chassis_impl();
+                cached = true;
+        }
+
+        return cache;
+}
+
 static char* context_fallback_icon_name(Context *c) {
         const char *chassis;
 
@@ -430,6 +444,31 @@ static int context_write_data_machine_info(Context *c) {
         return write_env_file_label("/etc/machine-info", l);
 }
 
+static int get_dmi_data(const char *database_key, const char *regular_key, char **ret) {
+        _cleanup_(sd_device_unrefp) sd_device *device = NULL;
+        const char *s = NULL;
+        char *b = NULL;
+        int r;
+
+        assert(ret);
+
+        r = sd_device_new_from_syspath(&device, "/sys/class/dmi/id");
+        if (r < 0)
+                return log_warning_errno(r, "Failed to open /sys/class/dmi/id device, ignoring: %m");
+
+        if (sd_device_get_property_value(device, database_key, &s) < 0 && regular_key)
+                (void) sd_device_get_property_value(device, regular_key, &s);
+
+        if (s) {
+                b = strdup(s);
+                if (!b)
+                        return -ENOMEM;
+        }
+
+        *ret = b;
+        return !!b;
+}
+
 static int property_get_hardware_vendor(
                 sd_bus *bus,
                 const char *path,
@@ -438,19 +477,15 @@ static int property_get_hardware_vendor(
                 sd_bus_message *reply,
                 void *userdata,
                 sd_bus_error *error) {
-        _cleanup_(sd_device_unrefp) sd_device *device = NULL;
-        const char *hardware_vendor = NULL;
-        int r;
+        static char *hardware_vendor = NULL;
+        static bool cached = false;
 
-        r = sd_device_new_from_syspath(&device, "/sys/class/dmi/id");
-        if (r < 0) {
-                log_warning_errno(r, "Failed to open /sys/class/dmi/id device, ignoring: %m");
-                return sd_bus_message_append(reply, "s", NULL);
+        /* DMI data cannot change while the system is up, read it once */
+        if (!cached) {
+                (void) get_dmi_data("ID_VENDOR_FROM_DATABASE", "ID_VENDOR", &hardware_vendor);
+                cached = true;
         }
 
-        if (sd_device_get_property_value(device, "ID_VENDOR_FROM_DATABASE", &hardware_vendor) < 0)
-                (void) sd_device_get_property_value(device, "ID_VENDOR", &hardware_vendor);
-
         return sd_bus_message_append(reply, "s", hardware_vendor);
 }
 
@@ -462,19 +497,14 @@ static int property_get_hardware_model(
                 sd_bus_message *reply,
                 void *userdata,
                 sd_bus_error *error) {
-        _cleanup_(sd_device_unrefp) sd_device *device = NULL;
-        const char *hardware_model = NULL;
-        int r;
+        static char *hardware_model = NULL;
+        static bool cached = false;
 
-        r = sd_device_new_from_syspath(&device, "/sys/class/dmi/id");
-        if (r < 0) {
-                log_warning_errno(r, "Failed to open /sys/class/dmi/id device, ignoring: %m");
-                return sd_bus_message_append(reply, "s", NULL);
+        if (!cached) {
+                (void) get_dmi_data("ID_MODEL_FROM_DATABASE", "ID_MODEL", &hardware_model);
+                cached = true;
         }
 
-        if (sd_device_get_property_value(device, "ID_MODEL_FROM_DATABASE", &hardware_model) < 0)
-                (void) sd_device_get_property_value(device, "ID_MODEL", &hardware_model);
-
         return sd_bus_message_append(reply, "s", hardware_model);
 }
 
@@ -24,7 +24,7 @@
 #include "tmpfile-util.h"
 #include "util.h"
 
-#define COPY_BUFFER_SIZE (16*1024)
+#define COPY_BUFFER_SIZE (64*1024)
 
 struct RawExport {
         sd_event *event;
@@ -13,7 +13,7 @@
 #include "tmpfile-util.h"
 #include "util.h"
 
-#define COPY_BUFFER_SIZE (16*1024)
+#define COPY_BUFFER_SIZE (64*1024)
 
 struct TarExport {
         sd_event *event;
@@ -3,6 +3,11 @@
 
 #include <sys/types.h>
 
+/* Read and decompress in reasonably large chunks: the import pipeline pays an event loop iteration and a
+ * decompressor invocation per input chunk, which dominates over the memory cost for the big images we
+ * typically shovel around here. */
+#define IMPORT_BUFFER_SIZE (256U*1024U)
+
 int import_make_read_only_fd(int fd);
 int import_make_read_only(const char *path);
 
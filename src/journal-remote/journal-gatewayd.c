@@ -28,7 +28,6 @@
 #include "parse-util.h"
 #include "pretty-print.h"
 #include "sigbus.h"
-#include "tmpfile-util.h"
 #include "util.h"
 
 #define JOURNAL_WAIT_TIMEOUT (10*USEC_PER_SEC)
@@ -53,6 +52,8 @@ typedef struct RequestMeta {
         bool n_entries_set;
 
         FILE *tmp;
+        char *tmp_buf;
+        size_t tmp_buf_size;
         uint64_t delta, size;
 
         int argument_parse_error;
@@ -98,6 +99,7 @@ static void request_meta_free(
         sd_journal_close(m->journal);
 
         safe_fclose(m->tmp);
+        free(m->tmp_buf);
 
         free(m->cursor);
         free(m);
@@ -121,15 +123,12 @@ static int request_meta_ensure_tmp(RequestMeta *m) {
         if (m->tmp)
                 rewind(m->tmp);
         else {
-                _cleanup_close_ int fd = -1;
-
-                fd = open_tmpfile_unlinkable("/tmp", O_RDWR|O_CLOEXEC);
-                if (fd < 0)
-                        return fd;
-
-                m->tmp = take_fdopen(&fd, "w+");
+                /* Serialize into a memory stream rather than an unlinked file in /tmp: each entry is
+                 * written and then immediately streamed out again, hence there's no point in taking a round
+                 * trip through the file system for it. */
+                m->tmp = open_memstream_unlocked(&m->tmp_buf, &m->tmp_buf_size);
                 if (!m->tmp)
-                        return -errno;
+                        return -ENOMEM;
         }
 
         return 0;
@@ -143,7 +142,7 @@ static ssize_t request_reader_entries(
 
         RequestMeta *m = cls;
         int r;
-        size_t n, k;
+        size_t n;
 
         assert(m);
         assert(buf);
@@ -223,6 +222,12 @@ static ssize_t request_reader_entries(
                         return MHD_CONTENT_READER_END_WITH_ERROR;
                 }
 
+                r = fflush_and_check(m->tmp);
+                if (r < 0) {
+                        log_error_errno(r, "Failed to flush memory stream: %m");
+                        return MHD_CONTENT_READER_END_WITH_ERROR;
+                }
+
                 sz = ftello(m->tmp);
                 if (sz == (off_t) -1) {
                         log_error_errno(errno, "Failed to retrieve file position: %m");
@@ -235,25 +240,14 @@ static ssize_t request_reader_entries(
         if (m->tmp == NULL && m->follow)
                 return 0;
 
-        if (fseeko(m->tmp, pos, SEEK_SET) < 0) {
-                log_error_errno(errno, "Failed to seek to position: %m");
-                return MHD_CONTENT_READER_END_WITH_ERROR;
-        }
-
         n = m->size - pos;
         if (n < 1)
                 return 0;
         if (n > max)
                 n = max;
 
-        errno = 0;
-        k = fread(buf, 1, n, m->tmp);
-        if (k != n) {
-                log_error("Failed to read from file: %s", errno != 0 ? strerror_safe(errno) : "Premature EOF");
-                return MHD_CONTENT_READER_END_WITH_ERROR;
-        }
-
-        return (ssize_t) k;
+        memcpy(buf, m->tmp_buf + pos, n);
+        return (ssize_t) n;
 }
 
 static int request_parse_accept(
@@ -535,7 +529,7 @@ static ssize_t request_reader_fields(
 
         RequestMeta *m = cls;
         int r;
-        size_t n, k;
+        size_t n;
 
         assert(m);
         assert(buf);
@@ -574,6 +568,12 @@ static ssize_t request_reader_fields(
                         return MHD_CONTENT_READER_END_WITH_ERROR;
                 }
 
+                r = fflush_and_check(m->tmp);
+                if (r < 0) {
+                        log_error_errno(r, "Failed to flush memory stream: %m");
+                        return MHD_CONTENT_READER_END_WITH_ERROR;
+                }
+
                 sz = ftello(m->tmp);
                 if (sz == (off_t) -1) {
                         log_error_errno(errno, "Failed to retrieve file position: %m");
@@ -583,23 +583,12 @@ static ssize_t request_reader_fields(
                 m->size = (uint64_t) sz;
         }
 
-        if (fseeko(m->tmp, pos, SEEK_SET) < 0) {
-                log_error_errno(errno, "Failed to seek to position: %m");
-                return MHD_CONTENT_READER_END_WITH_ERROR;
-        }
-
         n = m->size - pos;
         if (n > max)
                 n = max;
 
-        errno = 0;
-        k = fread(buf, 1, n, m->tmp);
-        if (k != n) {
-                log_error("Failed to read from file: %s", errno != 0 ? strerror_safe(errno) : "Premature EOF");
-                return MHD_CONTENT_READER_END_WITH_ERROR;
-        }
-
-        return (ssize_t) k;
+        memcpy(buf, m->tmp_buf + pos, n);
+        return (ssize_t) n;
 }
 
 static int request_handler_fields(
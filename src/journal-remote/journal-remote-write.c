@@ -18,15 +18,18 @@ static int do_rotate(JournalFile **f, bool compress, bool seal) {
 Writer* writer_new(RemoteServer *server) {
         Writer *w;
 
+        assert(server);
+
         w = new0(Writer, 1);
         if (!w)
                 return NULL;
 
         memset(&w->metrics, 0xFF, sizeof(w->metrics));
 
-        w->mmap = mmap_cache_new();
-        if (!w->mmap)
-                return mfree(w);
+        /* Share the server's mmap cache between all writers, the same way journald shares one across all
+         * journal files: the cache limits the number of mapped windows globally, which per-writer caches
+         * would defeat when writing one file per source host. */
+        w->mmap = mmap_cache_ref(server->mmap);
 
         w->n_ref = 1;
         w->server = server;
@@ -328,6 +328,10 @@ int journal_remote_server_init(
         if (r < 0)
                 return log_error_errno(r, "Failed to allocate event loop: %m");
 
+        s->mmap = mmap_cache_new();
+        if (!s->mmap)
+                return log_oom();
+
         r = init_writer_hashmap(s);
         if (r < 0)
                 return r;
@@ -358,6 +362,7 @@ void journal_remote_server_destroy(RemoteServer *s) {
 
         writer_unref(s->_single_writer);
         hashmap_free(s->writers);
+        mmap_cache_unref(s->mmap);
 
         sd_event_source_unref(s->sigterm_event);
         sd_event_source_unref(s->sigint_event);
@@ -31,6 +31,7 @@ struct RemoteServer {
 
         Hashmap *writers;
         Writer *_single_writer;
+        MMapCache *mmap; /* shared by all writers */
         uint64_t event_count;
 
 #if HAVE_MICROHTTPD
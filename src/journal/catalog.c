@@ -605,40 +605,68 @@ static const char *find_id(void *p, sd_id128_t id) {
                 le64toh(f->offset);
 }
 
+/* Resolving a message ID is done once per displayed entry by "journalctl -x", hence keep the database
+ * mapped across lookups instead of mmaping and unmapping it for each of them. The mapping is revalidated
+ * against the file on disk with a stat() per lookup, so a database rebuilt in the meantime (which replaces
+ * the file atomically) is picked up on the next call. The cache is thread-local since this ends up in the
+ * public library through sd_journal_get_catalog(), which may be called from multiple threads at once, and
+ * the revalidation must not unmap a mapping another thread is still reading from. */
+static thread_local struct {
+        char *database;
+        struct stat st;
+        void *p;
+} catalog_cache = {};
+
 int catalog_get(const char* database, sd_id128_t id, char **_text) {
-        _cleanup_close_ int fd = -1;
-        void *p = NULL;
-        struct stat st = {};
-        char *text = NULL;
-        int r;
+        struct stat st;
         const char *s;
+        char *text;
+        int r;
 
+        assert(database);
         assert(_text);
 
-        r = open_mmap(database, &fd, &st, &p);
-        if (r < 0)
-                return r;
-
-        s = find_id(p, id);
-        if (!s) {
-                r = -ENOENT;
-                goto finish;
+        /* Drop the cached mapping if it doesn't match the file currently on disk */
+        if (catalog_cache.p &&
+            (!streq(catalog_cache.database, database) ||
+             stat(database, &st) < 0 ||
+             st.st_dev != catalog_cache.st.st_dev ||
+             st.st_ino != catalog_cache.st.st_ino ||
+             st.st_size != catalog_cache.st.st_size)) {
+                munmap(catalog_cache.p, PAGE_ALIGN(catalog_cache.st.st_size));
+                catalog_cache.p = NULL;
+                catalog_cache.database = mfree(catalog_cache.database);
         }
 
-        text = strdup(s);
-        if (!text) {
-                r = -ENOMEM;
-                goto finish;
+        if (!catalog_cache.p) {
+                _cleanup_close_ int fd = -1;
+                _cleanup_free_ char *d = NULL;
+                void *p;
+
+                d = strdup(database);
+                if (!d)
+                        return -ENOMEM;
+
+                r = open_mmap(database, &fd, &st, &p);
+                if (r < 0)
+                        return r;
+
+                /* The mapping stays valid without the fd */
+                catalog_cache.database = TAKE_PTR(d);
+                catalog_cache.st = st;
+                catalog_cache.p = p;
         }
 
-        *_text = text;
-        r = 0;
+        s = find_id(catalog_cache.p, id);
+        if (!s)
+                return -ENOENT;
 
-finish:
-        if (p)
-                munmap(p, st.st_size);
+        text = strdup(s);
+        if (!text)
+                return -ENOMEM;
 
-        return r;
+        *_text = text;
+        return 0;
 }
 
 static char *find_header(const char *s, const char *header) {
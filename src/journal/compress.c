@@ -42,6 +42,29 @@ DEFINE_TRIVIAL_CLEANUP_FUNC(LZ4F_decompressionContext_t, LZ4F_freeDecompressionC
 DEFINE_TRIVIAL_CLEANUP_FUNC(ZSTD_CCtx *, ZSTD_freeCCtx);
 DEFINE_TRIVIAL_CLEANUP_FUNC(ZSTD_DCtx *, ZSTD_freeDCtx);
 
+/* Creating a zstd context allocates and initializes a sizable workspace, which dominates the cost of
+ * (de)compressing the small data objects journald deals in. Keep one context per thread around and reuse it;
+ * resetting an existing context between operations is cheap. The contexts are intentionally left to the OS
+ * at thread/process exit. */
+
+static ZSTD_CCtx* zstd_cctx(void) {
+        static thread_local ZSTD_CCtx *cctx = NULL;
+
+        if (!cctx)
+                cctx = ZSTD_createCCtx();
+
+        return cctx;
+}
+
+static ZSTD_DCtx* zstd_dctx(void) {
+        static thread_local ZSTD_DCtx *dctx = NULL;
+
+        if (!dctx)
+                dctx = ZSTD_createDCtx();
+
+        return dctx;
+}
+
 static int zstd_ret_to_errno(size_t ret) {
         switch (ZSTD_getErrorCode(ret)) {
         case ZSTD_error_dstSize_tooSmall:
@@ -138,6 +161,7 @@ int compress_blob_zstd(
                 const void *src, uint64_t src_size,
                 void *dst, size_t dst_alloc_size, size_t *dst_size) {
 #if HAVE_ZSTD
+        ZSTD_CCtx *cctx;
         size_t k;
 
         assert(src);
@@ -146,7 +170,11 @@ int compress_blob_zstd(
         assert(dst_alloc_size > 0);
         assert(dst_size);
 
-        k = ZSTD_compress(dst, dst_alloc_size, src, src_size, 0);
+        cctx = zstd_cctx();
+        if (!cctx)
+                return -ENOMEM;
+
+        k = ZSTD_compressCCtx(cctx, dst, dst_alloc_size, src, src_size, 0);
         if (ZSTD_isError(k))
                 return zstd_ret_to_errno(k);
 
@@ -283,10 +311,12 @@ int decompress_blob_zstd(
         if (!(greedy_realloc(dst, dst_alloc_size, MAX(ZSTD_DStreamOutSize(), size), 1)))
                 return -ENOMEM;
 
-        _cleanup_(ZSTD_freeDCtxp) ZSTD_DCtx *dctx = ZSTD_createDCtx();
+        ZSTD_DCtx *dctx = zstd_dctx();
         if (!dctx)
                 return -ENOMEM;
 
+        ZSTD_DCtx_reset(dctx, ZSTD_reset_session_only);
+
         ZSTD_inBuffer input = {
                 .src = src,
                 .size = src_size,
@@ -472,10 +502,12 @@ int decompress_startswith_zstd(
         if (size < prefix_len + 1)
                 return 0; /* Decompressed text too short to match the prefix and extra */
 
-        _cleanup_(ZSTD_freeDCtxp) ZSTD_DCtx *dctx = ZSTD_createDCtx();
+        ZSTD_DCtx *dctx = zstd_dctx();
         if (!dctx)
                 return -ENOMEM;
 
+        ZSTD_DCtx_reset(dctx, ZSTD_reset_session_only);
+
         if (!(greedy_realloc(buffer, buffer_size, MAX(ZSTD_DStreamOutSize(), prefix_len + 1), 1)))
                 return -ENOMEM;
 
@@ -862,6 +894,13 @@ int compress_stream_zstd(int fdf, int fdt, uint64_t max_bytes) {
         if (ZSTD_isError(z))
                 log_debug("Failed to enable ZSTD checksum, ignoring: %s", ZSTD_getErrorName(z));
 
+        /* Compress with multiple worker threads, if libzstd was built with threading support. This speeds
+         * up compression of large inputs (e.g. cores) considerably, overlaps compression with our read and
+         * write syscalls, and quietly stays single-threaded otherwise. */
+        z = ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, CLAMP(sysconf(_SC_NPROCESSORS_ONLN), 1L, 4L));
+        if (ZSTD_isError(z))
+                log_debug("Failed to enable ZSTD multi-threaded compression, ignoring: %s", ZSTD_getErrorName(z));
+
         /* This loop read from the input file, compresses that entire chunk,
          * and writes all output produced to the output file.
          */
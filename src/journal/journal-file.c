@@ -1410,6 +1410,16 @@ int journal_file_find_field_object(
                         ret, ret_offset);
 }
 
+static void journal_file_cache_data_object(JournalFile *f, uint64_t hash, uint64_t offset) {
+        assert(f);
+
+        f->data_dedup_cache[f->data_dedup_cache_idx] = (typeof(f->data_dedup_cache[0])) {
+                .hash = hash,
+                .offset = offset,
+        };
+        f->data_dedup_cache_idx = (f->data_dedup_cache_idx + 1) % ELEMENTSOF(f->data_dedup_cache);
+}
+
 int journal_file_find_data_object_with_hash(
                 JournalFile *f,
                 const void *data, uint64_t size, uint64_t hash,
@@ -1433,6 +1443,36 @@ int journal_file_find_data_object_with_hash(
 
         osize = offsetof(Object, data.payload) + size;
 
+        /* Consult the per-file dedup cache first: the trusted fields repeat for almost every message, and
+         * this saves us the hash table bucket load and chain walk for them. The cached offset is verified
+         * against the object it points to, hence a stale entry simply falls back to the regular walk. */
+        for (size_t i = 0; i < ELEMENTSOF(f->data_dedup_cache); i++) {
+                Object *o;
+
+                if (f->data_dedup_cache[i].offset == 0 || f->data_dedup_cache[i].hash != hash)
+                        continue;
+
+                r = journal_file_move_to_object(f, OBJECT_DATA, f->data_dedup_cache[i].offset, &o);
+                if (r < 0)
+                        break;
+
+                if (le64toh(o->data.hash) == hash &&
+                    !(o->object.flags & OBJECT_COMPRESSION_MASK) &&
+                    le64toh(o->object.size) == osize &&
+                    memcmp(o->data.payload, data, size) == 0) {
+
+                        if (ret)
+                                *ret = o;
+
+                        if (ret_offset)
+                                *ret_offset = f->data_dedup_cache[i].offset;
+
+                        return 1;
+                }
+
+                break;
+        }
+
         m = le64toh(READ_NOW(f->header->data_hash_table_size)) / sizeof(HashItem);
         if (m <= 0)
                 return -EBADMSG;
@@ -1483,6 +1523,8 @@ int journal_file_find_data_object_with_hash(
                 } else if (le64toh(o->object.size) == osize &&
                            memcmp(o->data.payload, data, size) == 0) {
 
+                        journal_file_cache_data_object(f, hash, p);
+
                         if (ret)
                                 *ret = o;
 
@@ -1698,6 +1740,9 @@ static int journal_file_append_data(
         if (r < 0)
                 return r;
 
+        if (compression == 0)
+                journal_file_cache_data_object(f, hash, p);
+
         if (!data)
                 eq = NULL;
         else
@@ -1769,12 +1814,60 @@ uint64_t journal_file_hash_table_n_items(Object *o) {
         return (sz - offsetof(Object, hash_table.items)) / sizeof(HashItem);
 }
 
+typedef struct ChainCacheItem {
+        uint64_t first; /* the array at the beginning of the chain */
+        uint64_t array; /* the cached array */
+        uint64_t begin; /* the first item in the cached array */
+        uint64_t total; /* the total number of items in all arrays before this one in the chain */
+        uint64_t last_index; /* the last index we looked at, to optimize locality when bisecting */
+} ChainCacheItem;
+
+static void chain_cache_put(
+                OrderedHashmap *h,
+                ChainCacheItem *ci,
+                uint64_t first,
+                uint64_t array,
+                uint64_t begin,
+                uint64_t total,
+                uint64_t last_index) {
+
+        if (!ci) {
+                /* If the chain item to cache for this chain is the
+                 * first one it's not worth caching anything */
+                if (array == first)
+                        return;
+
+                if (ordered_hashmap_size(h) >= CHAIN_CACHE_MAX) {
+                        ci = ordered_hashmap_steal_first(h);
+                        assert(ci);
+                } else {
+                        ci = new(ChainCacheItem, 1);
+                        if (!ci)
+                                return;
+                }
+
+                ci->first = first;
+
+                if (ordered_hashmap_put(h, &ci->first, ci) < 0) {
+                        free(ci);
+                        return;
+                }
+        } else
+                assert(ci->first == first);
+
+        ci->array = array;
+        ci->begin = begin;
+        ci->total = total;
+        ci->last_index = last_index;
+}
+
 static int link_entry_into_array(JournalFile *f,
                                  le64_t *first,
                                  le64_t *idx,
                                  uint64_t p) {
         int r;
-        uint64_t n = 0, ap = 0, q, i, a, hidx;
+        uint64_t n = 0, ap = 0, q, i, a, hidx, t = 0, fp;
+        ChainCacheItem *ci;
         Object *o;
 
         assert(f);
@@ -1783,8 +1876,19 @@ static int link_entry_into_array(JournalFile *f,
         assert(idx);
         assert(p > 0);
 
-        a = le64toh(*first);
+        fp = le64toh(*first);
+        a = fp;
         i = hidx = le64toh(READ_NOW(*idx));
+
+        /* Appends always go to the tail of the chain, hence skip ahead to the cached tail array instead of
+         * walking there link by link from the front for every single entry. */
+        ci = ordered_hashmap_get(f->chain_cache, &fp);
+        if (ci && hidx >= ci->total) {
+                a = ci->array;
+                i -= ci->total;
+                t = ci->total;
+        }
+
         while (a > 0) {
 
                 r = journal_file_move_to_object(f, OBJECT_ENTRY_ARRAY, a, &o);
@@ -1795,10 +1899,12 @@ static int link_entry_into_array(JournalFile *f,
                 if (i < n) {
                         o->entry_array.items[i] = htole64(p);
                         *idx = htole64(hidx + 1);
+                        chain_cache_put(f->chain_cache, ci, fp, a, le64toh(o->entry_array.items[0]), t, i);
                         return 0;
                 }
 
                 i -= n;
+                t += n;
                 ap = a;
                 a = le64toh(o->entry_array.next_entry_array_offset);
         }
@@ -1840,6 +1946,11 @@ static int link_entry_into_array(JournalFile *f,
 
         *idx = htole64(hidx + 1);
 
+        /* Remember the newly appended array as the chain's tail, unless we just created the chain and its
+         * head offset hence changed. */
+        if (ap != 0)
+                chain_cache_put(f->chain_cache, ci, fp, q, p, t, i);
+
         return 0;
 }
 
@@ -2164,53 +2275,6 @@ int journal_file_append_entry(
         return r;
 }
 
-typedef struct ChainCacheItem {
-        uint64_t first; /* the array at the beginning of the chain */
-        uint64_t array; /* the cached array */
-        uint64_t begin; /* the first item in the cached array */
-        uint64_t total; /* the total number of items in all arrays before this one in the chain */
-        uint64_t last_index; /* the last index we looked at, to optimize locality when bisecting */
-} ChainCacheItem;
-
-static void chain_cache_put(
-                OrderedHashmap *h,
-                ChainCacheItem *ci,
-                uint64_t first,
-                uint64_t array,
-                uint64_t begin,
-                uint64_t total,
-                uint64_t last_index) {
-
-        if (!ci) {
-                /* If the chain item to cache for this chain is the
-                 * first one it's not worth caching anything */
-                if (array == first)
-                        return;
-
-                if (ordered_hashmap_size(h) >= CHAIN_CACHE_MAX) {
-                        ci = ordered_hashmap_steal_first(h);
-                        assert(ci);
-                } else {
-                        ci = new(ChainCacheItem, 1);
-                        if (!ci)
-                                return;
-                }
-
-                ci->first = first;
-
-                if (ordered_hashmap_put(h, &ci->first, ci) < 0) {
-                        free(ci);
-                        return;
-                }
-        } else
-                assert(ci->first == first);
-
-        ci->array = array;
-        ci->begin = begin;
-        ci->total = total;
-        ci->last_index = last_index;
-}
-
 static int generic_array_get(
                 JournalFile *f,
                 uint64_t first,
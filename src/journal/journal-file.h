@@ -100,6 +100,16 @@ typedef struct JournalFile {
 
         OrderedHashmap *chain_cache;
 
+        /* Tiny round-robin cache of recently written data objects, to short-circuit the in-file hash table
+         * walk for fields that repeat in bursts, as the trusted fields journald attaches to every message
+         * do. Entries are verified against the actual object before use, hence stale or colliding slots are
+         * harmless. */
+        struct {
+                uint64_t hash;
+                uint64_t offset;
+        } data_dedup_cache[16];
+        size_t data_dedup_cache_idx;
+
         pthread_t offline_thread;
         volatile OfflineState offline_state;
 
@@ -34,6 +34,13 @@ struct Match {
         size_t size;
         uint64_t hash; /* old-style jenkins hash. New-style siphash is different per file, hence won't be cached here */
 
+        /* For concrete matches: the offset of this match's data object in each journal file, so that
+         * iterating entries doesn't walk the data hash table chain again on every step. An offset of zero
+         * records that the file does not contain the match at all, which lets us skip such files without
+         * touching their hash tables; these negative entries are revalidated whenever the file's data object
+         * count changes. */
+        Hashmap *file_offset_cache;
+
         /* For terms */
         LIST_HEAD(Match, matches);
 };
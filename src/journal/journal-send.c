@@ -2,6 +2,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <printf.h>
 #include <stddef.h>
 #include <sys/un.h>
@@ -203,30 +204,13 @@ finish:
         return r;
 }
 
-_public_ int sd_journal_sendv(const struct iovec *iov, int n) {
-        PROTECT_ERRNO;
-        int fd, r;
-        _cleanup_close_ int buffer_fd = -1;
-        struct iovec *w;
-        uint64_t *l;
-        int i, j = 0;
-        static const union sockaddr_union sa = {
-                .un.sun_family = AF_UNIX,
-                .un.sun_path = "/run/systemd/journal/socket",
-        };
-        struct msghdr mh = {
-                .msg_name = (struct sockaddr*) &sa.sa,
-                .msg_namelen = SOCKADDR_UN_LEN(sa.un),
-        };
-        ssize_t k;
+static int entry_serialize(const struct iovec *iov, int n, struct iovec *w, uint64_t *l, int *j) {
         bool have_syslog_identifier = false;
-        bool seal = true;
+        int i, k = *j;
 
-        assert_return(iov, -EINVAL);
-        assert_return(n > 0, -EINVAL);
-
-        w = newa(struct iovec, n * 5 + 3);
-        l = newa(uint64_t, n);
+        /* Appends one entry in the native wire format to the iovec array w, which the caller sized
+         * appropriately: each field takes up to five iovecs, plus three for the implicit syslog
+         * identifier. */
 
         for (i = 0; i < n; i++) {
                 char *c, *nl;
@@ -252,19 +236,19 @@ _public_ int sd_journal_sendv(const struct iovec *iov, int n) {
                          * newline, then the size (64bit LE), followed
                          * by the data and a final newline */
 
-                        w[j++] = IOVEC_MAKE(iov[i].iov_base, c - (char*) iov[i].iov_base);
-                        w[j++] = IOVEC_MAKE_STRING("\n");
+                        w[k++] = IOVEC_MAKE(iov[i].iov_base, c - (char*) iov[i].iov_base);
+                        w[k++] = IOVEC_MAKE_STRING("\n");
 
                         l[i] = htole64(iov[i].iov_len - (c - (char*) iov[i].iov_base) - 1);
-                        w[j++] = IOVEC_MAKE(&l[i], sizeof(uint64_t));
+                        w[k++] = IOVEC_MAKE(&l[i], sizeof(uint64_t));
 
-                        w[j++] = IOVEC_MAKE(c + 1, iov[i].iov_len - (c - (char*) iov[i].iov_base) - 1);
+                        w[k++] = IOVEC_MAKE(c + 1, iov[i].iov_len - (c - (char*) iov[i].iov_base) - 1);
                 } else
                         /* Nothing special? Then just add the line and
                          * append a newline */
-                        w[j++] = iov[i];
+                        w[k++] = iov[i];
 
-                w[j++] = IOVEC_MAKE_STRING("\n");
+                w[k++] = IOVEC_MAKE_STRING("\n");
         }
 
         if (!have_syslog_identifier &&
@@ -276,11 +260,29 @@ _public_ int sd_journal_sendv(const struct iovec *iov, int n) {
                  * since everything else is much nicer to retrieve
                  * from the outside. */
 
-                w[j++] = IOVEC_MAKE_STRING("SYSLOG_IDENTIFIER=");
-                w[j++] = IOVEC_MAKE_STRING(program_invocation_short_name);
-                w[j++] = IOVEC_MAKE_STRING("\n");
+                w[k++] = IOVEC_MAKE_STRING("SYSLOG_IDENTIFIER=");
+                w[k++] = IOVEC_MAKE_STRING(program_invocation_short_name);
+                w[k++] = IOVEC_MAKE_STRING("\n");
         }
 
+        *j = k;
+        return 0;
+}
+
+static int send_serialized(struct iovec *w, int j) {
+        _cleanup_close_ int buffer_fd = -1;
+        static const union sockaddr_union sa = {
+                .un.sun_family = AF_UNIX,
+                .un.sun_path = "/run/systemd/journal/socket",
+        };
+        struct msghdr mh = {
+                .msg_name = (struct sockaddr*) &sa.sa,
+                .msg_namelen = SOCKADDR_UN_LEN(sa.un),
+        };
+        ssize_t k;
+        bool seal = true;
+        int fd, r;
+
         fd = journal_fd();
         if (_unlikely_(fd < 0))
                 return fd;
@@ -319,9 +321,14 @@ _public_ int sd_journal_sendv(const struct iovec *iov, int n) {
                         return buffer_fd;
         }
 
-        n = writev(buffer_fd, w, j);
-        if (n < 0)
-                return -errno;
+        /* A large batch may serialize into more iovecs than writev() accepts in one go (IOV_MAX), in
+         * which case the sendmsg() above failed with EMSGSIZE and we end up here, hence copy the data
+         * over in IOV_MAX-sized chunks. Short writes are not a concern: this is a memfd or tmpfs file. */
+        for (int i = 0; i < j; i += IOV_MAX) {
+                k = writev(buffer_fd, w + i, MIN(j - i, IOV_MAX));
+                if (k < 0)
+                        return -errno;
+        }
 
         if (seal) {
                 r = memfd_set_sealed(buffer_fd);
@@ -336,6 +343,74 @@ _public_ int sd_journal_sendv(const struct iovec *iov, int n) {
         return r;
 }
 
+_public_ int sd_journal_sendv(const struct iovec *iov, int n) {
+        PROTECT_ERRNO;
+        struct iovec *w;
+        uint64_t *l;
+        int j = 0, r;
+
+        assert_return(iov, -EINVAL);
+        assert_return(n > 0, -EINVAL);
+
+        w = newa(struct iovec, n * 5 + 3);
+        l = newa(uint64_t, n);
+
+        r = entry_serialize(iov, n, w, l, &j);
+        if (r < 0)
+                return r;
+
+        return send_serialized(w, j);
+}
+
+/* We assemble the whole batch on the stack, hence refuse unreasonably large batches. This matches the
+ * per-entry field limit journald enforces anyway. */
+#define SENDV_BATCH_FIELDS_MAX 1024
+
+_public_ int sd_journal_sendv_batch(const struct iovec *iov, const int *n_fields, int n_entries) {
+        PROTECT_ERRNO;
+        struct iovec *w;
+        uint64_t *l;
+        size_t total = 0, off;
+        int i, j = 0, r;
+
+        /* Like sd_journal_sendv(), but submits multiple entries in one datagram: entry i consists of the
+         * n_fields[i] iovecs following the previous entry's in iov. journald's native protocol separates
+         * entries within one message by an empty line, hence this needs nothing new on the receiving
+         * side. */
+
+        assert_return(iov, -EINVAL);
+        assert_return(n_fields, -EINVAL);
+        assert_return(n_entries > 0, -EINVAL);
+
+        for (i = 0; i < n_entries; i++) {
+                if (n_fields[i] <= 0)
+                        return -EINVAL;
+
+                total += (size_t) n_fields[i];
+        }
+
+        if (total > SENDV_BATCH_FIELDS_MAX)
+                return -E2BIG;
+
+        w = newa(struct iovec, total * 5 + 4 * (size_t) n_entries);
+        l = newa(uint64_t, total);
+
+        off = 0;
+        for (i = 0; i < n_entries; i++) {
+                r = entry_serialize(iov + off, n_fields[i], w, l + off, &j);
+                if (r < 0)
+                        return r;
+
+                /* Entries are separated by an empty line */
+                if (i < n_entries - 1)
+                        w[j++] = IOVEC_MAKE_STRING("\n");
+
+                off += (size_t) n_fields[i];
+        }
+
+        return send_serialized(w, j);
+}
+
 static int fill_iovec_perror_and_send(const char *message, int skip, struct iovec iov[]) {
         PROTECT_ERRNO;
         size_t n, k;
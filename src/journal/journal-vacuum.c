@@ -11,9 +11,11 @@
 #include "fd-util.h"
 #include "format-util.h"
 #include "fs-util.h"
+#include "hashmap.h"
 #include "journal-def.h"
 #include "journal-file.h"
 #include "journal-vacuum.h"
+#include "path-util.h"
 #include "sort-util.h"
 #include "string-util.h"
 #include "time-util.h"
@@ -30,6 +32,33 @@ struct vacuum_info {
         bool have_seqnum;
 };
 
+/* Archived journal files are immutable, hence remember the accounting data we derived for them the last time
+ * around, keyed by the file path and validated against size and mtime. journald vacuums on every rotation,
+ * and with many thousands of archived files the emptiness check and the creation time lookup (an open() plus
+ * pread() resp. getxattr() per file) dominate the scan otherwise. */
+
+typedef struct VacuumCacheEntry {
+        uint64_t size;
+        usec_t mtime;
+        usec_t realtime;
+} VacuumCacheEntry;
+
+static Hashmap *vacuum_cache = NULL;
+
+#define VACUUM_CACHE_MAX (64*1024)
+
+static void vacuum_cache_forget(const char *directory, const char *filename) {
+        _cleanup_free_ char *key = NULL, *old_key = NULL;
+        VacuumCacheEntry *e;
+
+        key = path_join(directory, filename);
+        if (!key)
+                return;
+
+        e = hashmap_remove2(vacuum_cache, key, (void**) &old_key);
+        free(e);
+}
+
 static int vacuum_compare(const struct vacuum_info *a, const struct vacuum_info *b) {
         int r;
 
@@ -150,10 +179,12 @@ int journal_directory_vacuum(
         FOREACH_DIRENT_ALL(de, d, r = -errno; goto finish) {
 
                 unsigned long long seqnum = 0, realtime;
-                _cleanup_free_ char *p = NULL;
+                _cleanup_free_ char *p = NULL, *key = NULL;
+                VacuumCacheEntry *e;
                 sd_id128_t seqnum_id;
                 bool have_seqnum;
                 uint64_t size;
+                usec_t mtime;
                 struct stat st;
                 size_t q;
 
@@ -238,29 +269,70 @@ int journal_directory_vacuum(
                 }
 
                 size = 512UL * (uint64_t) st.st_blocks;
+                mtime = timespec_load(&st.st_mtim);
 
-                r = journal_file_empty(dirfd(d), p);
-                if (r < 0) {
-                        log_debug_errno(r, "Failed check if %s is empty, ignoring: %m", p);
-                        continue;
+                key = path_join(directory, p);
+                if (!key) {
+                        r = -ENOMEM;
+                        goto finish;
                 }
-                if (r > 0) {
-                        /* Always vacuum empty non-online files. */
 
-                        r = unlinkat_deallocate(dirfd(d), p, 0);
-                        if (r >= 0) {
+                e = hashmap_get(vacuum_cache, key);
+                if (e && e->size == size && e->mtime == mtime)
+                        /* Unchanged since we last looked at it, reuse what we derived back then and spare
+                         * ourselves the emptiness check and creation time lookup. */
+                        realtime = e->realtime;
+                else {
+                        r = journal_file_empty(dirfd(d), p);
+                        if (r < 0) {
+                                log_debug_errno(r, "Failed check if %s is empty, ignoring: %m", p);
+                                continue;
+                        }
+                        if (r > 0) {
+                                /* Always vacuum empty non-online files. */
 
-                                log_full(verbose ? LOG_INFO : LOG_DEBUG,
-                                         "Deleted empty archived journal %s/%s (%s).", directory, p, format_bytes(sbytes, sizeof(sbytes), size));
+                                r = unlinkat_deallocate(dirfd(d), p, 0);
+                                if (r >= 0) {
 
-                                freed += size;
-                        } else if (r != -ENOENT)
-                                log_warning_errno(r, "Failed to delete empty archived journal %s/%s: %m", directory, p);
+                                        log_full(verbose ? LOG_INFO : LOG_DEBUG,
+                                                 "Deleted empty archived journal %s/%s (%s).", directory, p, format_bytes(sbytes, sizeof(sbytes), size));
 
-                        continue;
-                }
+                                        freed += size;
+                                } else if (r != -ENOENT)
+                                        log_warning_errno(r, "Failed to delete empty archived journal %s/%s: %m", directory, p);
 
-                patch_realtime(dirfd(d), p, &st, &realtime);
+                                continue;
+                        }
+
+                        patch_realtime(dirfd(d), p, &st, &realtime);
+
+                        if (e) {
+                                e->size = size;
+                                e->mtime = mtime;
+                                e->realtime = realtime;
+                        } else {
+                                /* Start over when the cache grows implausibly large, e.g. because files
+                                 * keep vanishing behind our back. */
+                                if (hashmap_size(vacuum_cache) >= VACUUM_CACHE_MAX)
+                                        hashmap_clear_free_free(vacuum_cache);
+
+                                /* The cache is strictly an optimization, hence don't bother the caller if we
+                                 * can't add to it. */
+                                e = new(VacuumCacheEntry, 1);
+                                if (e) {
+                                        *e = (VacuumCacheEntry) {
+                                                .size = size,
+                                                .mtime = mtime,
+                                                .realtime = realtime,
+                                        };
+
+                                        if (hashmap_ensure_put(&vacuum_cache, &string_hash_ops_free_free, key, e) < 0)
+                                                free(e);
+                                        else
+                                                TAKE_PTR(key);
+                                }
+                        }
+                }
 
                 if (!GREEDY_REALLOC(list, n_allocated, n_list + 1)) {
                         r = -ENOMEM;
@@ -294,6 +366,7 @@ int journal_directory_vacuum(
                 r = unlinkat_deallocate(dirfd(d), list[i].filename, 0);
                 if (r >= 0) {
                         log_full(verbose ? LOG_INFO : LOG_DEBUG, "Deleted archived journal %s/%s (%s).", directory, list[i].filename, format_bytes(sbytes, sizeof(sbytes), list[i].usage));
+                        vacuum_cache_forget(directory, list[i].filename);
                         freed += list[i].usage;
 
                         if (list[i].usage < sum)
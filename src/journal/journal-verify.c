@@ -895,6 +895,11 @@ int journal_file_verify(
                         goto fail;
                 }
 
+        /* The passes below stream through the whole file front to back, possibly many gigabytes of it. Tell
+         * the kernel, so that it uses a large readahead window on the file instead of faulting pages in one
+         * by one. This is purely advisory. */
+        (void) posix_fadvise(f->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
         /* First iteration: we go through all objects, verify the
          * superficial structure, headers, hashes. */
 
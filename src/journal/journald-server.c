@@ -80,6 +80,10 @@
 
 #define IDLE_TIMEOUT_USEC (30*USEC_PER_SEC)
 
+/* How many queued datagrams to drain from a socket per event loop dispatch. Bounded so that a flood of log
+ * messages cannot starve the other event sources. */
+#define DATAGRAMS_PER_DISPATCH 16
+
 static int determine_path_usage(
                 Server *s,
                 const char *path,
@@ -1255,35 +1259,6 @@ int server_process_datagram(
                 void *userdata) {
 
         Server *s = userdata;
-        struct ucred *ucred = NULL;
-        struct timeval *tv = NULL;
-        struct cmsghdr *cmsg;
-        char *label = NULL;
-        size_t label_len = 0, m;
-        struct iovec iovec;
-        ssize_t n;
-        int *fds = NULL, v = 0;
-        size_t n_fds = 0;
-
-        /* We use NAME_MAX space for the SELinux label here. The kernel currently enforces no limit, but
-         * according to suggestions from the SELinux people this will change and it will probably be
-         * identical to NAME_MAX. For now we use that, but this should be updated one day when the final
-         * limit is known. */
-        CMSG_BUFFER_TYPE(CMSG_SPACE(sizeof(struct ucred)) +
-                         CMSG_SPACE(sizeof(struct timeval)) +
-                         CMSG_SPACE(sizeof(int)) + /* fd */
-                         CMSG_SPACE(NAME_MAX) /* selinux label */) control;
-
-        union sockaddr_union sa = {};
-
-        struct msghdr msghdr = {
-                .msg_iov = &iovec,
-                .msg_iovlen = 1,
-                .msg_control = &control,
-                .msg_controllen = sizeof(control),
-                .msg_name = &sa,
-                .msg_namelen = sizeof(sa),
-        };
 
         assert(s);
         assert(fd == s->native_fd || fd == s->syslog_fd || fd == s->audit_fd);
@@ -1293,80 +1268,115 @@ int server_process_datagram(
                                        "Got invalid event from epoll for datagram fd: %" PRIx32,
                                        revents);
 
-        /* Try to get the right size, if we can. (Not all sockets support SIOCINQ, hence we just try, but don't rely on
-         * it.) */
-        (void) ioctl(fd, SIOCINQ, &v);
-
-        /* Fix it up, if it is too small. We use the same fixed value as auditd here. Awful! */
-        m = PAGE_ALIGN(MAX3((size_t) v + 1,
-                            (size_t) LINE_MAX,
-                            ALIGN(sizeof(struct nlmsghdr)) + ALIGN((size_t) MAX_AUDIT_MESSAGE_LENGTH)) + 1);
-
-        if (!GREEDY_REALLOC(s->buffer, s->buffer_size, m))
-                return log_oom();
+        /* Process a bounded batch of queued datagrams per event loop dispatch: draining the socket in one
+         * go amortizes the wakeup across many messages when clients log in bursts, while the bound keeps
+         * us from starving the other event sources. */
+        for (unsigned iteration = 0; iteration < DATAGRAMS_PER_DISPATCH; iteration++) {
+                struct ucred *ucred = NULL;
+                struct timeval *tv = NULL;
+                struct cmsghdr *cmsg;
+                char *label = NULL;
+                size_t label_len = 0, m;
+                struct iovec iovec;
+                ssize_t n;
+                int *fds = NULL, v = 0;
+                size_t n_fds = 0;
+
+                /* We use NAME_MAX space for the SELinux label here. The kernel currently enforces no limit, but
+                 * according to suggestions from the SELinux people this will change and it will probably be
+                 * identical to NAME_MAX. For now we use that, but this should be updated one day when the final
+                 * limit is known. */
+                CMSG_BUFFER_TYPE(CMSG_SPACE(sizeof(struct ucred)) +
+                                 CMSG_SPACE(sizeof(struct timeval)) +
+                                 CMSG_SPACE(sizeof(int)) + /* fd */
+                                 CMSG_SPACE(NAME_MAX) /* selinux label */) control;
+
+                union sockaddr_union sa = {};
+
+                struct msghdr msghdr = {
+                        .msg_iov = &iovec,
+                        .msg_iovlen = 1,
+                        .msg_control = &control,
+                        .msg_controllen = sizeof(control),
+                        .msg_name = &sa,
+                        .msg_namelen = sizeof(sa),
+                };
+
+                /* Try to get the right size, if we can. (Not all sockets support SIOCINQ, hence we just try, but don't rely on
+                 * it.) */
+                (void) ioctl(fd, SIOCINQ, &v);
+
+                /* Fix it up, if it is too small. We use the same fixed value as auditd here. Awful! */
+                m = PAGE_ALIGN(MAX3((size_t) v + 1,
+                                    (size_t) LINE_MAX,
+                                    ALIGN(sizeof(struct nlmsghdr)) + ALIGN((size_t) MAX_AUDIT_MESSAGE_LENGTH)) + 1);
+
+                if (!GREEDY_REALLOC(s->buffer, s->buffer_size, m))
+                        return log_oom();
 
-        iovec = IOVEC_MAKE(s->buffer, s->buffer_size - 1); /* Leave room for trailing NUL we add later */
+                iovec = IOVEC_MAKE(s->buffer, s->buffer_size - 1); /* Leave room for trailing NUL we add later */
 
-        n = recvmsg_safe(fd, &msghdr, MSG_DONTWAIT|MSG_CMSG_CLOEXEC);
-        if (IN_SET(n, -EINTR, -EAGAIN))
-                return 0;
-        if (n == -EXFULL) {
-                log_warning("Got message with truncated control data (too many fds sent?), ignoring.");
-                return 0;
-        }
-        if (n < 0)
-                return log_error_errno(n, "recvmsg() failed: %m");
-
-        CMSG_FOREACH(cmsg, &msghdr)
-                if (cmsg->cmsg_level == SOL_SOCKET &&
-                    cmsg->cmsg_type == SCM_CREDENTIALS &&
-                    cmsg->cmsg_len == CMSG_LEN(sizeof(struct ucred))) {
-                        assert(!ucred);
-                        ucred = (struct ucred*) CMSG_DATA(cmsg);
-                } else if (cmsg->cmsg_level == SOL_SOCKET &&
-                         cmsg->cmsg_type == SCM_SECURITY) {
-                        assert(!label);
-                        label = (char*) CMSG_DATA(cmsg);
-                        label_len = cmsg->cmsg_len - CMSG_LEN(0);
-                } else if (cmsg->cmsg_level == SOL_SOCKET &&
-                           cmsg->cmsg_type == SO_TIMESTAMP &&
-                           cmsg->cmsg_len == CMSG_LEN(sizeof(struct timeval))) {
-                        assert(!tv);
-                        tv = (struct timeval*) CMSG_DATA(cmsg);
-                } else if (cmsg->cmsg_level == SOL_SOCKET &&
-                         cmsg->cmsg_type == SCM_RIGHTS) {
-                        assert(!fds);
-                        fds = (int*) CMSG_DATA(cmsg);
-                        n_fds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+                n = recvmsg_safe(fd, &msghdr, MSG_DONTWAIT|MSG_CMSG_CLOEXEC);
+                if (IN_SET(n, -EINTR, -EAGAIN))
+                        break; /* The queue is drained, we are done for this dispatch */
+                if (n == -EXFULL) {
+                        log_warning("Got message with truncated control data (too many fds sent?), ignoring.");
+                        continue;
                 }
+                if (n < 0)
+                        return log_error_errno(n, "recvmsg() failed: %m");
+
+                CMSG_FOREACH(cmsg, &msghdr)
+                        if (cmsg->cmsg_level == SOL_SOCKET &&
+                            cmsg->cmsg_type == SCM_CREDENTIALS &&
+                            cmsg->cmsg_len == CMSG_LEN(sizeof(struct ucred))) {
+                                assert(!ucred);
+                                ucred = (struct ucred*) CMSG_DATA(cmsg);
+                        } else if (cmsg->cmsg_level == SOL_SOCKET &&
+                                 cmsg->cmsg_type == SCM_SECURITY) {
+                                assert(!label);
+                                label = (char*) CMSG_DATA(cmsg);
+                                label_len = cmsg->cmsg_len - CMSG_LEN(0);
+                        } else if (cmsg->cmsg_level == SOL_SOCKET &&
+                                   cmsg->cmsg_type == SO_TIMESTAMP &&
+                                   cmsg->cmsg_len == CMSG_LEN(sizeof(struct timeval))) {
+                                assert(!tv);
+                                tv = (struct timeval*) CMSG_DATA(cmsg);
+                        } else if (cmsg->cmsg_level == SOL_SOCKET &&
+                                 cmsg->cmsg_type == SCM_RIGHTS) {
+                                assert(!fds);
+                                fds = (int*) CMSG_DATA(cmsg);
+                                n_fds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+                        }
 
-        /* And a trailing NUL, just in case */
-        s->buffer[n] = 0;
+                /* And a trailing NUL, just in case */
+                s->buffer[n] = 0;
 
-        if (fd == s->syslog_fd) {
-                if (n > 0 && n_fds == 0)
-                        server_process_syslog_message(s, s->buffer, n, ucred, tv, label, label_len);
-                else if (n_fds > 0)
-                        log_warning("Got file descriptors via syslog socket. Ignoring.");
+                if (fd == s->syslog_fd) {
+                        if (n > 0 && n_fds == 0)
+                                server_process_syslog_message(s, s->buffer, n, ucred, tv, label, label_len);
+                        else if (n_fds > 0)
+                                log_warning("Got file descriptors via syslog socket. Ignoring.");
 
-        } else if (fd == s->native_fd) {
-                if (n > 0 && n_fds == 0)
-                        server_process_native_message(s, s->buffer, n, ucred, tv, label, label_len);
-                else if (n == 0 && n_fds == 1)
-                        server_process_native_file(s, fds[0], ucred, tv, label, label_len);
-                else if (n_fds > 0)
-                        log_warning("Got too many file descriptors via native socket. Ignoring.");
+                } else if (fd == s->native_fd) {
+                        if (n > 0 && n_fds == 0)
+                                server_process_native_message(s, s->buffer, n, ucred, tv, label, label_len);
+                        else if (n == 0 && n_fds == 1)
+                                server_process_native_file(s, fds[0], ucred, tv, label, label_len);
+                        else if (n_fds > 0)
+                                log_warning("Got too many file descriptors via native socket. Ignoring.");
 
-        } else {
-                assert(fd == s->audit_fd);
+                } else {
+                        assert(fd == s->audit_fd);
 
-                if (n > 0 && n_fds == 0)
-                        server_process_audit_message(s, s->buffer, n, ucred, &sa, msghdr.msg_namelen);
-                else if (n_fds > 0)
-                        log_warning("Got file descriptors via audit socket. Ignoring.");
-        }
+                        if (n > 0 && n_fds == 0)
+                                server_process_audit_message(s, s->buffer, n, ucred, &sa, msghdr.msg_namelen);
+                        else if (n_fds > 0)
+                                log_warning("Got file descriptors via audit socket. Ignoring.");
+                }
 
-        close_many(fds, n_fds);
+                close_many(fds, n_fds);
+        }
 
         server_refresh_idle_timer(s);
         return 0;
@@ -2268,6 +2278,9 @@ int server_init(Server *s, const char *namespace) {
         if (r < 0)
                 return log_error_errno(r, "Failed to create event loop: %m");
 
+        /* Under log storms many stream/datagram sources are ready at once, dispatch them in one go */
+        (void) sd_event_set_dispatch_batch(s->event, true);
+
         n = sd_listen_fds(true);
         if (n < 0)
                 return log_error_errno(n, "Failed to read listening file descriptors from environment: %m");
@@ -241,6 +241,12 @@ fail:
         return log_error_errno(r, "Failed to save stream data %s: %m", s->state_file);
 }
 
+/* Reusable scratch buffer for assembling the MESSAGE= field, so that logging a line doesn't mean a heap
+ * allocation per line. journald is single-threaded and the buffer is only used within stdout_stream_log(),
+ * hence one buffer shared by all streams suffices. */
+static char *message_scratch = NULL;
+static size_t message_scratch_allocated = 0;
+
 static int stdout_stream_log(
                 StdoutStream *s,
                 const char *p,
@@ -250,8 +256,8 @@ static int stdout_stream_log(
         int priority;
         char syslog_priority[] = "PRIORITY=\0";
         char syslog_facility[STRLEN("SYSLOG_FACILITY=") + DECIMAL_STR_MAX(int) + 1];
-        _cleanup_free_ char *message = NULL, *syslog_identifier = NULL;
-        size_t n = 0, m;
+        _cleanup_free_ char *syslog_identifier = NULL;
+        size_t n = 0, m, k;
         int r;
 
         assert(s);
@@ -326,9 +332,11 @@ static int stdout_stream_log(
         if (c)
                 iovec[n++] = IOVEC_MAKE_STRING(c);
 
-        message = strjoin("MESSAGE=", p);
-        if (message)
-                iovec[n++] = IOVEC_MAKE_STRING(message);
+        k = strlen(p);
+        if (GREEDY_REALLOC(message_scratch, message_scratch_allocated, STRLEN("MESSAGE=") + k)) {
+                memcpy(mempcpy(message_scratch, "MESSAGE=", STRLEN("MESSAGE=")), p, k);
+                iovec[n++] = IOVEC_MAKE(message_scratch, STRLEN("MESSAGE=") + k);
+        }
 
         server_dispatch_message(s->server, iovec, n, m, s->context, NULL, priority, 0);
         return 0;
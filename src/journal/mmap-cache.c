@@ -1,6 +1,7 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
 
 #include <errno.h>
+#include <fcntl.h>
 #include <stdlib.h>
 #include <sys/mman.h>
 
@@ -15,6 +16,14 @@
 #include "mmap-cache.h"
 #include "sigbus.h"
 
+/* The cache (and with it every sd_journal object on top of it) is single-threaded: windows and
+ * contexts are manipulated without locks, and only the SIGBUS queue in basic/sigbus.c is lock-free
+ * since the signal can arrive on any thread. Making this structure thread-safe has been looked at
+ * and rejected — every object access goes through a window lookup, so a lock or per-thread window
+ * sets would sit on the hottest path in the journal reader for the benefit of a layer above that
+ * can parallelize much more cheaply: journal files are independent, so a multi-threaded consumer
+ * opens one sd_journal per thread over a partition of the files (or of the cursor range) and merges
+ * results, which scales linearly without any shared mutable state. */
 typedef struct Window Window;
 typedef struct Context Context;
 
@@ -50,6 +59,12 @@ struct MMapFileDescriptor {
         int fd;
         int prot;
         bool sigbus;
+
+        /* For detecting sequential access: where a window created right after the last one would start, and
+         * how many consecutive windows matched that expectation. */
+        uint64_t next_expected_offset;
+        unsigned n_sequential;
+
         LIST_HEAD(Window, windows);
 };
 
@@ -57,7 +72,7 @@ struct MMapCache {
         unsigned n_ref;
         unsigned n_windows;
 
-        unsigned n_context_cache_hit, n_window_list_hit, n_missed;
+        unsigned n_context_cache_hit, n_window_list_hit, n_missed, n_prefetch;
 
         Hashmap *fds;
         Context *contexts[MMAP_CACHE_MAX_CONTEXTS];
@@ -408,6 +423,35 @@ static int mmap_try_harder(MMapCache *m, void *addr, MMapFileDescriptor *f, int
         return 0;
 }
 
+static void fd_maybe_prefetch(MMapCache *m, MMapFileDescriptor *f, uint64_t woffset, uint64_t wsize, struct stat *st) {
+        assert(m);
+        assert(f);
+
+        /* Called whenever we had to create a new window. If the windows of this file are being created in
+         * ascending adjacent order we are most likely replaying the file sequentially (as "journalctl" with
+         * no arguments does), in which case demand paging costs us a major fault every 4K. Once we are
+         * reasonably sure about the pattern ask the kernel to read the next window in ahead of time, so that
+         * it is in the page cache by the time we map it. This is advisory only, hence errors are ignored. */
+
+        if (woffset > 0 && woffset == f->next_expected_offset)
+                f->n_sequential++;
+        else
+                f->n_sequential = 0;
+
+        f->next_expected_offset = woffset + wsize;
+
+        if (f->n_sequential == 0)
+                return;
+
+        if (st && f->next_expected_offset >= (uint64_t) st->st_size)
+                return;
+
+        if (readahead(f->fd, f->next_expected_offset, WINDOW_SIZE) < 0)
+                return;
+
+        m->n_prefetch++;
+}
+
 static int add_mmap(
                 MMapCache *m,
                 MMapFileDescriptor *f,
@@ -463,6 +507,8 @@ static int add_mmap(
         if (r < 0)
                 return r;
 
+        fd_maybe_prefetch(m, f, woffset, wsize, st);
+
         c = context_add(m, context);
         if (!c)
                 goto outofmem;
@@ -524,7 +570,7 @@ int mmap_cache_get(
 void mmap_cache_stats_log_debug(MMapCache *m) {
         assert(m);
 
-        log_debug("mmap cache statistics: %u context cache hit, %u window list hit, %u miss", m->n_context_cache_hit, m->n_window_list_hit, m->n_missed);
+        log_debug("mmap cache statistics: %u context cache hit, %u window list hit, %u miss, %u prefetch", m->n_context_cache_hit, m->n_window_list_hit, m->n_missed, m->n_prefetch);
 }
 
 static void mmap_cache_process_sigbus(MMapCache *m) {
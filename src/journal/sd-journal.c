@@ -226,10 +226,23 @@ static void match_free(Match *m) {
         if (m->parent)
                 LIST_REMOVE(matches, m->parent->matches, m);
 
+        hashmap_free_free(m->file_offset_cache);
         free(m->data);
         free(m);
 }
 
+static void match_drop_file_cache(Match *m, JournalFile *f) {
+        Match *i;
+
+        if (!m)
+                return;
+
+        free(hashmap_remove(m->file_offset_cache, f));
+
+        LIST_FOREACH(matches, i, m->matches)
+                match_drop_file_cache(i, f);
+}
+
 static void match_free_if_empty(Match *m) {
         if (!m || m->matches)
                 return;
@@ -487,6 +500,71 @@ _pure_ static int compare_with_location(const JournalFile *f, const Location *l,
         return 0;
 }
 
+typedef struct MatchOffsetCacheEntry {
+        uint64_t offset; /* offset of the data object, or 0 if the file doesn't contain the match */
+        uint64_t n_data; /* the file's data object count when we looked, to revalidate negative entries */
+} MatchOffsetCacheEntry;
+
+static int match_find_data_object(Match *m, JournalFile *f, uint64_t *ret_offset) {
+        MatchOffsetCacheEntry *e;
+        uint64_t hash, dp = 0, n_data;
+        int r;
+
+        assert(m);
+        assert(m->type == MATCH_DISCRETE);
+        assert(f);
+        assert(ret_offset);
+
+        n_data = le64toh(f->header->n_data);
+
+        e = hashmap_get(m->file_offset_cache, f);
+        if (e) {
+                if (e->offset != 0) {
+                        /* Data objects never move within a file, hence positive entries stay valid for the
+                         * lifetime of the file. */
+                        *ret_offset = e->offset;
+                        return 1;
+                }
+
+                /* Negative entries stay valid as long as no data objects were added to the file. */
+                if (e->n_data == n_data)
+                        return 0;
+        }
+
+        /* If the keyed hash logic is used, we need to calculate the hash fresh per file. Otherwise we can
+         * use what we pre-calculated. */
+        if (JOURNAL_HEADER_KEYED_HASH(f->header))
+                hash = journal_file_hash_data(f, m->data, m->size);
+        else
+                hash = m->hash;
+
+        r = journal_file_find_data_object_with_hash(f, m->data, m->size, hash, NULL, &dp);
+        if (r < 0)
+                return r;
+
+        if (e) {
+                e->offset = r > 0 ? dp : 0;
+                e->n_data = n_data;
+        } else {
+                /* The cache is strictly an optimization, silently proceed without it if we hit OOM here. */
+                e = new(MatchOffsetCacheEntry, 1);
+                if (e) {
+                        *e = (MatchOffsetCacheEntry) {
+                                .offset = r > 0 ? dp : 0,
+                                .n_data = n_data,
+                        };
+
+                        if (hashmap_ensure_put(&m->file_offset_cache, NULL, f, e) < 0)
+                                free(e);
+                }
+        }
+
+        if (r > 0)
+                *ret_offset = dp;
+
+        return r;
+}
+
 static int next_for_match(
                 sd_journal *j,
                 Match *m,
@@ -505,16 +583,9 @@ static int next_for_match(
         assert(f);
 
         if (m->type == MATCH_DISCRETE) {
-                uint64_t dp, hash;
+                uint64_t dp;
 
-                /* If the keyed hash logic is used, we need to calculate the hash fresh per file. Otherwise
-                 * we can use what we pre-calculated. */
-                if (JOURNAL_HEADER_KEYED_HASH(f->header))
-                        hash = journal_file_hash_data(f, m->data, m->size);
-                else
-                        hash = m->hash;
-
-                r = journal_file_find_data_object_with_hash(f, m->data, m->size, hash, NULL, &dp);
+                r = match_find_data_object(m, f, &dp);
                 if (r <= 0)
                         return r;
 
@@ -601,14 +672,9 @@ static int find_location_for_match(
         assert(f);
 
         if (m->type == MATCH_DISCRETE) {
-                uint64_t dp, hash;
+                uint64_t dp;
 
-                if (JOURNAL_HEADER_KEYED_HASH(f->header))
-                        hash = journal_file_hash_data(f, m->data, m->size);
-                else
-                        hash = m->hash;
-
-                r = journal_file_find_data_object_with_hash(f, m->data, m->size, hash, NULL, &dp);
+                r = match_find_data_object(m, f, &dp);
                 if (r <= 0)
                         return r;
 
@@ -1431,6 +1497,8 @@ static void remove_file_real(sd_journal *j, JournalFile *f) {
 
         (void) ordered_hashmap_remove(j->files, f->path);
 
+        match_drop_file_cache(j->level0, f);
+
         log_debug("File %s removed.", f->path);
 
         if (j->current_file == f) {
@@ -6,6 +6,7 @@
 
 #include "sd-journal.h"
 #include "fileio.h"
+#include "io-util.h"
 #include "macro.h"
 #include "memory-util.h"
 
@@ -92,9 +93,36 @@ static void test_journal_send(void) {
         assert_se(sd_journal_sendv(message2, 1) == 0);
 }
 
+static void test_journal_sendv_batch(void) {
+        struct iovec iov[400];
+        int n_fields[200], i;
+
+        /* 200 entries of two fields each. This is well within the field limit, but serializes to far
+         * more iovecs than IOV_MAX, so this exercises the memfd fallback with chunked writing. */
+        for (i = 0; i < 200; i++) {
+                iov[2 * i] = IOVEC_MAKE_STRING("MESSAGE=batch test entry");
+                iov[2 * i + 1] = IOVEC_MAKE_STRING("BATCH_TEST=1");
+                n_fields[i] = 2;
+        }
+
+        assert_se(sd_journal_sendv_batch(iov, n_fields, 200) == 0);
+
+        /* A single-entry batch is equivalent to sd_journal_sendv() */
+        assert_se(sd_journal_sendv_batch(iov, n_fields, 1) == 0);
+
+        assert_se(sd_journal_sendv_batch(NULL, n_fields, 1) == -EINVAL);
+        assert_se(sd_journal_sendv_batch(iov, NULL, 1) == -EINVAL);
+        assert_se(sd_journal_sendv_batch(iov, n_fields, 0) == -EINVAL);
+        n_fields[0] = 0;
+        assert_se(sd_journal_sendv_batch(iov, n_fields, 200) == -EINVAL);
+        n_fields[0] = 2048;
+        assert_se(sd_journal_sendv_batch(iov, n_fields, 200) == -E2BIG);
+}
+
 int main(int argc, char *argv[]) {
         test_journal_print();
         test_journal_send();
+        test_journal_sendv_batch();
 
         /* Sleep a bit to make it easy for journald to collect metadata. */
         sleep(1);
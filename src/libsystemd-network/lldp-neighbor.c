@@ -26,6 +26,20 @@ int lldp_neighbor_id_compare_func(const LLDPNeighborID *x, const LLDPNeighborID
 DEFINE_HASH_OPS_WITH_VALUE_DESTRUCTOR(lldp_neighbor_hash_ops, LLDPNeighborID, lldp_neighbor_id_hash_func, lldp_neighbor_id_compare_func,
                                       sd_lldp_neighbor, lldp_neighbor_unlink);
 
+static void lldp_neighbor_raw_hash_func(const sd_lldp_neighbor *n, struct siphash *state) {
+        siphash24_compress(&n->raw_size, sizeof(n->raw_size), state);
+        siphash24_compress(LLDP_NEIGHBOR_RAW(n), n->raw_size, state);
+}
+
+static int lldp_neighbor_raw_compare_func(const sd_lldp_neighbor *x, const sd_lldp_neighbor *y) {
+        return memcmp_nn(LLDP_NEIGHBOR_RAW(x), x->raw_size, LLDP_NEIGHBOR_RAW(y), y->raw_size);
+}
+
+/* Indexes neighbors by the raw datagram they were unpacked from, so that an identical re-announcement can be
+ * recognized before we bother parsing it again. Since the raw data covers the Ethernet header and all TLVs,
+ * raw equality implies MSAP equality, i.e. this is strictly finer than lldp_neighbor_hash_ops. */
+DEFINE_HASH_OPS(lldp_neighbor_raw_hash_ops, sd_lldp_neighbor, lldp_neighbor_raw_hash_func, lldp_neighbor_raw_compare_func);
+
 int lldp_neighbor_prioq_compare_func(const void *a, const void *b) {
         const sd_lldp_neighbor *x = a, *y = b;
 
@@ -88,6 +102,7 @@ sd_lldp_neighbor *lldp_neighbor_unlink(sd_lldp_neighbor *n) {
          * ourselves from the hashtable and sometimes are called after we already are de-registered. */
 
         (void) hashmap_remove_value(n->lldp->neighbor_by_id, &n->id, n);
+        (void) hashmap_remove_value(n->lldp->neighbor_by_raw, n, n);
 
         assert_se(prioq_remove(n->lldp->neighbor_by_expiry, n, &n->prioq_idx) >= 0);
 
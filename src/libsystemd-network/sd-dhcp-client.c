@@ -1646,7 +1646,7 @@ static int client_handle_ack(sd_dhcp_client *client, DHCPMessage *ack, size_t le
 }
 
 static int client_set_lease_timeouts(sd_dhcp_client *client) {
-        usec_t time_now;
+        usec_t time_now, accuracy;
         char time_string[FORMAT_TIMESPAN_MAX];
         int r;
 
@@ -1695,6 +1695,15 @@ static int client_set_lease_timeouts(sd_dhcp_client *client) {
         /* after fuzzing, ensure t2 is still >= t1 */
         client->t2_time = MAX(client->t1_time, client->t2_time);
 
+        /* When many clients share one event loop (hosts with hundreds of DHCP-enabled interfaces),
+         * identical lease lifetimes would make all T1/T2 timers fire back-to-back. The RFC fuzz above
+         * already decorrelates them by up to ±1s; additionally give these timers a coarse accuracy so
+         * that the event loop may coalesce neighbouring renewals into a single wakeup. Renewal moments
+         * are soft deadlines — T2 and lease expiry are still far away at that point. The expiry timer
+         * itself stays tight. */
+        accuracy = CLAMP(usec_sub_unsigned(client->t2_time, client->t1_time) / 10,
+                         10 * USEC_PER_MSEC, 10 * USEC_PER_SEC);
+
         /* arm lifetime timeout */
         r = event_reset_time(client->event, &client->timeout_expire,
                              clock_boottime_or_monotonic(),
@@ -1714,7 +1723,7 @@ static int client_set_lease_timeouts(sd_dhcp_client *client) {
         /* arm T2 timeout */
         r = event_reset_time(client->event, &client->timeout_t2,
                              clock_boottime_or_monotonic(),
-                             client->t2_time, 10 * USEC_PER_MSEC,
+                             client->t2_time, accuracy,
                              client_timeout_t2, client,
                              client->event_priority, "dhcp4-t2-timeout", true);
         if (r < 0)
@@ -1730,7 +1739,7 @@ static int client_set_lease_timeouts(sd_dhcp_client *client) {
         /* arm T1 timeout */
         r = event_reset_time(client->event, &client->timeout_t1,
                              clock_boottime_or_monotonic(),
-                             client->t1_time, 10 * USEC_PER_MSEC,
+                             client->t1_time, accuracy,
                              client_timeout_t1, client,
                              client->event_priority, "dhcp4-t1-timer", true);
         if (r < 0)
@@ -705,6 +705,21 @@ static int get_pool_offset(sd_dhcp_server *server, be32_t requested_ip) {
         return be32toh(requested_ip & ~server->netmask) - server->pool_offset;
 }
 
+static void server_free_bound_lease(sd_dhcp_server *server, DHCPLease *lease) {
+        int pool_offset;
+
+        assert(server);
+        assert(lease);
+        assert(lease != &server->invalid_lease);
+
+        pool_offset = get_pool_offset(server, lease->address);
+        if (pool_offset >= 0 && server->bound_leases[pool_offset] == lease)
+                server->bound_leases[pool_offset] = NULL;
+
+        hashmap_remove(server->leases_by_client_id, &lease->client_id);
+        dhcp_lease_free(lease);
+}
+
 #define HASH_KEY SD_ID128_MAKE(0d,1d,fe,bd,f1,24,bd,b3,47,f1,dd,6e,73,21,93,30)
 
 int dhcp_server_handle_message(sd_dhcp_server *server, DHCPMessage *message,
@@ -712,6 +727,7 @@ int dhcp_server_handle_message(sd_dhcp_server *server, DHCPMessage *message,
         _cleanup_(dhcp_request_freep) DHCPRequest *req = NULL;
         _cleanup_free_ char *error_message = NULL;
         DHCPLease *existing_lease;
+        usec_t time_now = 0;
         int type, r;
 
         assert(server);
@@ -735,9 +751,19 @@ int dhcp_server_handle_message(sd_dhcp_server *server, DHCPMessage *message,
                 /* this only fails on critical errors */
                 return r;
 
+        r = sd_event_now(server->event, clock_boottime_or_monotonic(), &time_now);
+        if (r < 0)
+                return r;
+
         existing_lease = hashmap_get(server->leases_by_client_id,
                                      &req->client_id);
 
+        /* If the client's old lease ran out, reclaim it right away, and proceed as if it never existed. */
+        if (existing_lease && existing_lease->expiration < time_now) {
+                server_free_bound_lease(server, existing_lease);
+                existing_lease = NULL;
+        }
+
         switch(type) {
 
         case DHCP_DISCOVER: {
@@ -769,7 +795,16 @@ int dhcp_server_handle_message(sd_dhcp_server *server, DHCPMessage *message,
                         next_offer = hash % server->pool_size;
 
                         for (i = 0; i < server->pool_size; i++) {
-                                if (!server->bound_leases[next_offer]) {
+                                DHCPLease *l = server->bound_leases[next_offer];
+
+                                /* Reclaim slots whose lease ran out, so that expired bindings
+                                   cannot exhaust the pool permanently */
+                                if (l && l != &server->invalid_lease && l->expiration < time_now) {
+                                        server_free_bound_lease(server, l);
+                                        l = NULL;
+                                }
+
+                                if (!l) {
                                         address = server->subnet | htobe32(server->pool_offset + next_offer);
                                         break;
                                 }
@@ -854,7 +889,6 @@ int dhcp_server_handle_message(sd_dhcp_server *server, DHCPMessage *message,
                 if (pool_offset >= 0 &&
                     server->bound_leases[pool_offset] == existing_lease) {
                         DHCPLease *lease;
-                        usec_t time_now = 0;
 
                         if (!existing_lease) {
                                 lease = new0(DHCPLease, 1);
@@ -874,15 +908,6 @@ int dhcp_server_handle_message(sd_dhcp_server *server, DHCPMessage *message,
                         } else
                                 lease = existing_lease;
 
-                        r = sd_event_now(server->event,
-                                         clock_boottime_or_monotonic(),
-                                         &time_now);
-                        if (r < 0) {
-                                if (!existing_lease)
-                                        dhcp_lease_free(lease);
-                                return r;
-                        }
-
                         lease->expiration = req->lifetime * USEC_PER_SEC + time_now;
 
                         r = server_send_ack(server, req, address);
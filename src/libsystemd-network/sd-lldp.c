@@ -158,6 +158,13 @@ static int lldp_add_neighbor(sd_lldp *lldp, sd_lldp_neighbor *n) {
                 goto finish;
         }
 
+        r = hashmap_put(lldp->neighbor_by_raw, n, n);
+        if (r < 0) {
+                assert_se(hashmap_remove(lldp->neighbor_by_id, &n->id) == n);
+                assert_se(prioq_remove(lldp->neighbor_by_expiry, n, &n->prioq_idx) >= 0);
+                goto finish;
+        }
+
         n->lldp = lldp;
 
         lldp_start_timer(lldp, n);
@@ -196,6 +203,7 @@ static int lldp_handle_datagram(sd_lldp *lldp, sd_lldp_neighbor *n) {
 
 static int lldp_receive_datagram(sd_event_source *s, int fd, uint32_t revents, void *userdata) {
         _cleanup_(sd_lldp_neighbor_unrefp) sd_lldp_neighbor *n = NULL;
+        sd_lldp_neighbor *existing;
         ssize_t space, length;
         sd_lldp *lldp = userdata;
         struct timespec ts;
@@ -230,6 +238,17 @@ static int lldp_receive_datagram(sd_event_source *s, int fd, uint32_t revents, v
         else
                 triple_timestamp_get(&n->timestamp);
 
+        /* If the datagram is bit-for-bit identical to one we already have on record — which is the common
+         * case, since neighbors typically retransmit unchanged data every few seconds — then just restart the
+         * TTL counter of the old entry, and don't bother parsing the TLVs again. */
+        existing = hashmap_get(lldp->neighbor_by_raw, n);
+        if (existing && lldp_keep_neighbor(lldp, existing)) {
+                existing->timestamp = n->timestamp;
+                lldp_start_timer(lldp, existing);
+                lldp_callback(lldp, SD_LLDP_EVENT_REFRESHED, existing);
+                return 0;
+        }
+
         return lldp_handle_datagram(lldp, n);
 }
 
@@ -353,6 +372,7 @@ static sd_lldp* lldp_free(sd_lldp *lldp) {
         lldp_flush_neighbors(lldp);
 
         hashmap_free(lldp->neighbor_by_id);
+        hashmap_free(lldp->neighbor_by_raw);
         prioq_free(lldp->neighbor_by_expiry);
         return mfree(lldp);
 }
@@ -380,6 +400,10 @@ _public_ int sd_lldp_new(sd_lldp **ret) {
         if (!lldp->neighbor_by_id)
                 return -ENOMEM;
 
+        lldp->neighbor_by_raw = hashmap_new(&lldp_neighbor_raw_hash_ops);
+        if (!lldp->neighbor_by_raw)
+                return -ENOMEM;
+
         r = prioq_ensure_allocated(&lldp->neighbor_by_expiry, lldp_neighbor_prioq_compare_func);
         if (r < 0)
                 return r;
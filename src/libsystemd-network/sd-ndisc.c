@@ -202,18 +202,21 @@ static int ndisc_handle_datagram(sd_ndisc *nd, sd_ndisc_router *rt) {
         return 0;
 }
 
-static int ndisc_recv(sd_event_source *s, int fd, uint32_t revents, void *userdata) {
+/* Read at most this many RAs per event loop iteration, so that a burst — e.g. all routers answering our
+ * solicitation at once — is drained in one wakeup without starving other event sources. */
+#define NDISC_DATAGRAMS_PER_DISPATCH 16U
+
+static int ndisc_recv_one(sd_ndisc *nd, int fd) {
         _cleanup_(sd_ndisc_router_unrefp) sd_ndisc_router *rt = NULL;
-        sd_ndisc *nd = userdata;
+        _cleanup_free_ char *addr = NULL;
         ssize_t buflen;
         int r;
-        _cleanup_free_ char *addr = NULL;
 
-        assert(s);
         assert(nd);
-        assert(nd->event);
 
         buflen = next_datagram_size_fd(fd);
+        if (buflen == -EAGAIN) /* Drained the socket */
+                return 0;
         if (buflen < 0)
                 return log_ndisc_errno(buflen, "Failed to determine datagram size to read: %m");
 
@@ -238,19 +241,48 @@ static int ndisc_recv(sd_event_source *s, int fd, uint32_t revents, void *userda
                         break;
 
                 case -EAGAIN: /* ignore spurious wakeups */
-                        break;
+                        return 0;
 
                 default:
                         log_ndisc_errno(r, "Unexpected error while reading from ICMPv6, ignoring: %m");
                         break;
                 }
 
-                return 0;
+                return 1; /* The datagram was consumed, even if we ignored it */
         }
 
         (void) event_source_disable(nd->timeout_event_source);
 
-        return ndisc_handle_datagram(nd, rt);
+        r = ndisc_handle_datagram(nd, rt);
+        if (r < 0)
+                return r;
+
+        return 1;
+}
+
+static int ndisc_recv(sd_event_source *s, int fd, uint32_t revents, void *userdata) {
+        _cleanup_(sd_ndisc_unrefp) sd_ndisc *nd = sd_ndisc_ref(userdata);
+
+        assert(s);
+        assert(nd);
+        assert(nd->event);
+
+        for (unsigned i = 0; i < NDISC_DATAGRAMS_PER_DISPATCH; i++) {
+                int r;
+
+                /* The callback invoked from ndisc_recv_one() may call sd_ndisc_stop(), which closes
+                 * nd->fd — and the fd number may immediately be reused by a socket the callback opened
+                 * (e.g. when networkd starts DHCPv6). Hence re-check before each read that we are still
+                 * draining the socket we were dispatched for. */
+                if (nd->fd < 0 || nd->fd != fd)
+                        return 0;
+
+                r = ndisc_recv_one(nd, fd);
+                if (r <= 0)
+                        return r;
+        }
+
+        return 0;
 }
 
 static usec_t ndisc_timeout_compute_random(usec_t val) {
@@ -624,6 +624,14 @@ _public_ int sd_bus_query_sender_creds(sd_bus_message *call, uint64_t mask, sd_b
                 return 0;
         }
 
+        /* Maybe an earlier query on this message already augmented everything we need? Then avoid
+         * hitting /proc again. (Note that the augmented mask is best-effort: bits that couldn't be
+         * retrieved are not set in it, and we'll retry them below, like a fresh query would.) */
+        if (call->augmented_creds && (mask & ~call->augmented_creds->mask & ~SD_BUS_CREDS_AUGMENT) == 0) {
+                *ret = sd_bus_creds_ref(call->augmented_creds);
+                return 0;
+        }
+
         /* No data passed? Or not enough data passed to retrieve the missing bits? */
         if (!c || !(c->mask & SD_BUS_CREDS_PID)) {
                 /* We couldn't read anything from the call, let's try
@@ -639,14 +647,25 @@ _public_ int sd_bus_query_sender_creds(sd_bus_message *call, uint64_t mask, sd_b
                         return sd_bus_get_owner_creds(call->bus, mask, ret);
         }
 
+        /* Extend from the previously augmented set if there is one, so that fields retrieved by an
+         * earlier query are reused instead of being read from /proc once more. */
+        if (call->augmented_creds && (call->augmented_creds->mask & SD_BUS_CREDS_PID))
+                c = call->augmented_creds;
+
         r = bus_creds_extend_by_pid(c, mask, ret);
         if (r == -ESRCH) {
                 /* Process doesn't exist anymore? propagate the few things we have */
                 *ret = sd_bus_creds_ref(c);
                 return 0;
         }
+        if (r < 0)
+                return r;
 
-        return r;
+        /* Remember what we retrieved, for the next query on this message */
+        sd_bus_creds_unref(call->augmented_creds);
+        call->augmented_creds = sd_bus_creds_ref(*ret);
+
+        return 0;
 }
 
 _public_ int sd_bus_query_sender_privilege(sd_bus_message *call, int capability) {
@@ -244,6 +244,10 @@ struct sd_bus {
         Hashmap *vtable_methods;
         Hashmap *vtable_properties;
 
+        /* Number of fallback object callbacks and fallback vtables currently registered. If zero,
+         * bus_process_object() can skip the walk over all parent path prefixes entirely. */
+        unsigned n_fallbacks;
+
         union sockaddr_union sockaddr;
         socklen_t sockaddr_size;
 
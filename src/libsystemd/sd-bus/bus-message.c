@@ -146,6 +146,7 @@ static sd_bus_message* message_free(sd_bus_message *m) {
         message_free_last_container(m);
 
         bus_creds_done(&m->creds);
+        sd_bus_creds_unref(m->augmented_creds);
         return mfree(m);
 }
 
@@ -169,19 +170,32 @@ static void *message_extend_fields(sd_bus_message *m, size_t align, size_t sz, b
         if (old_size == new_size)
                 return (uint8_t*) m->header + old_size;
 
+        /* Grow geometrically: fields are appended one by one while a message is built, and reallocating for
+         * each of them means copying the header over and over. */
+        size_t a = ALIGN8(new_size);
+        if (a <= SIZE_MAX / 2)
+                a *= 2;
+
         if (m->free_header) {
-                np = realloc(m->header, ALIGN8(new_size));
-                if (!np)
-                        goto poison;
+                if (ALIGN8(new_size) <= m->header_allocated)
+                        np = m->header;
+                else {
+                        np = realloc(m->header, a);
+                        if (!np)
+                                goto poison;
+
+                        m->header_allocated = a;
+                }
         } else {
                 /* Initially, the header is allocated as part of
                  * the sd_bus_message itself, let's replace it by
                  * dynamic data */
 
-                np = malloc(ALIGN8(new_size));
+                np = malloc(a);
                 if (!np)
                         goto poison;
 
+                m->header_allocated = a;
                 memcpy(np, m->header, sizeof(struct bus_header));
         }
 
@@ -5679,14 +5693,29 @@ int bus_message_get_arg(sd_bus_message *m, unsigned i, const char **str) {
         assert(m);
         assert(str);
 
-        r = bus_message_get_arg_skip(m, i, &type, NULL);
-        if (r < 0)
-                return r;
+        /* Matching runs this for each arg rule in the match tree, and each run otherwise means rewinding
+         * and re-parsing the body, hence cache the low-numbered arguments. The cached pointers reference
+         * the message body and stay valid as long as the message does. */
+        if (i < ELEMENTSOF(m->arg_cache) && (m->arg_cache_mask & (1U << i))) {
+                if (!m->arg_cache[i])
+                        return -ENXIO;
 
-        if (!IN_SET(type, SD_BUS_TYPE_STRING, SD_BUS_TYPE_OBJECT_PATH, SD_BUS_TYPE_SIGNATURE))
-                return -ENXIO;
+                *str = m->arg_cache[i];
+                return 0;
+        }
 
-        return sd_bus_message_read_basic(m, type, str);
+        r = bus_message_get_arg_skip(m, i, &type, NULL);
+        if (r >= 0 && !IN_SET(type, SD_BUS_TYPE_STRING, SD_BUS_TYPE_OBJECT_PATH, SD_BUS_TYPE_SIGNATURE))
+                r = -ENXIO;
+        if (r >= 0)
+                r = sd_bus_message_read_basic(m, type, str);
+
+        if (i < ELEMENTSOF(m->arg_cache) && (r >= 0 || r == -ENXIO)) {
+                m->arg_cache[i] = r >= 0 ? *str : NULL;
+                m->arg_cache_mask |= 1U << i;
+        }
+
+        return r;
 }
 
 int bus_message_get_arg_strv(sd_bus_message *m, unsigned i, char ***strv) {
@@ -73,6 +73,10 @@ struct sd_bus_message {
 
         sd_bus_creds creds;
 
+        /* Cache of the augmented sender creds, filled in by the first sd_bus_query_sender_creds() call on
+         * this message, so that later queries don't hit /proc again. */
+        sd_bus_creds *augmented_creds;
+
         usec_t monotonic;
         usec_t realtime;
         uint64_t seqnum;
@@ -94,6 +98,8 @@ struct sd_bus_message {
         size_t header_accessible;
         size_t footer_accessible;
 
+        size_t header_allocated; /* bytes allocated for the (dynamic) header, so that appending fields
+                                  * doesn't realloc for every single one */
         size_t fields_size;
         size_t body_size;
         size_t user_body_size;
@@ -130,6 +136,12 @@ struct sd_bus_message {
         unsigned n_header_offsets;
 
         uint64_t read_counter;
+
+        /* Cache for bus_match_run(): the first few string arguments, resolved at most once per message
+         * instead of re-parsing the body for every arg match rule. An entry is valid if its bit is set in
+         * the mask; NULL records that the argument doesn't exist or isn't a string. */
+        const char *arg_cache[4];
+        unsigned arg_cache_mask;
 };
 
 static inline bool BUS_MESSAGE_NEED_BSWAP(sd_bus_message *m) {
@@ -1434,9 +1434,6 @@ int bus_process_object(sd_bus *bus, sd_bus_message *m) {
 
         pl = strlen(m->path);
         assert(pl <= BUS_PATH_SIZE_MAX);
-        prefix = new(char, pl + 1);
-        if (!prefix)
-                return -ENOMEM;
 
         do {
                 bus->nodes_modified = false;
@@ -1445,7 +1442,18 @@ int bus_process_object(sd_bus *bus, sd_bus_message *m) {
                 if (r != 0)
                         return r;
 
-                /* Look for fallback prefixes */
+                /* Look for fallback prefixes, but only if any fallbacks are registered on this
+                 * connection at all. This saves us both the walk over all parent prefixes and the
+                 * prefix buffer allocation on the fast path. */
+                if (bus->n_fallbacks == 0)
+                        continue;
+
+                if (!prefix) {
+                        prefix = new(char, pl + 1);
+                        if (!prefix)
+                                return -ENOMEM;
+                }
+
                 OBJECT_PATH_FOREACH_PREFIX(prefix, m->path) {
 
                         if (bus->nodes_modified)
@@ -1629,6 +1637,8 @@ static int bus_add_object(
         s->node_callback.node = n;
         LIST_PREPEND(callbacks, n->callbacks, &s->node_callback);
         bus->nodes_modified = true;
+        if (fallback)
+                bus->n_fallbacks++;
 
         if (slot)
                 *slot = s;
@@ -1975,6 +1985,8 @@ static int add_object_vtable_internal(
         s->node_vtable.node = n;
         LIST_INSERT_AFTER(vtables, n->vtables, existing, &s->node_vtable);
         bus->nodes_modified = true;
+        if (fallback)
+                bus->n_fallbacks++;
 
         if (slot)
                 *slot = s;
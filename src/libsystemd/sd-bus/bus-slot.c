@@ -84,6 +84,10 @@ void bus_slot_disconnect(sd_bus_slot *slot, bool unref) {
                 if (slot->node_callback.node) {
                         LIST_REMOVE(callbacks, slot->node_callback.node->callbacks, &slot->node_callback);
                         slot->bus->nodes_modified = true;
+                        if (slot->node_callback.is_fallback) {
+                                assert(slot->bus->n_fallbacks > 0);
+                                slot->bus->n_fallbacks--;
+                        }
 
                         bus_node_gc(slot->bus, slot->node_callback.node);
                 }
@@ -154,6 +158,10 @@ void bus_slot_disconnect(sd_bus_slot *slot, bool unref) {
                 if (slot->node_vtable.node) {
                         LIST_REMOVE(vtables, slot->node_vtable.node->vtables, &slot->node_vtable);
                         slot->bus->nodes_modified = true;
+                        if (slot->node_vtable.is_fallback) {
+                                assert(slot->bus->n_fallbacks > 0);
+                                slot->bus->n_fallbacks--;
+                        }
 
                         bus_node_gc(slot->bus, slot->node_vtable.node);
                 }
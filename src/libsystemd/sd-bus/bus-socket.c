@@ -1069,6 +1069,106 @@ int bus_socket_write_message(sd_bus *bus, sd_bus_message *m, size_t *idx) {
         return 1;
 }
 
+/* When flushing the write queue, pack up to this many bytes and iovecs of consecutive sealed messages into
+ * one sendmsg()/writev(). PID 1 can queue thousands of small signal messages during a transaction, and
+ * writing them one syscall at a time makes the syscall the dominant cost. */
+#define WRITE_COALESCE_BYTES_MAX (256U*1024U)
+#define WRITE_COALESCE_IOVECS_MAX 64U
+
+int bus_socket_write_queue(sd_bus *bus, size_t *idx) {
+        sd_bus_message *m;
+        struct iovec *iov;
+        size_t n_iov, bytes, q;
+        ssize_t k;
+        unsigned j;
+        int r;
+
+        assert(bus);
+        assert(idx);
+        assert(bus->wqueue_size > 0);
+        assert(IN_SET(bus->state, BUS_RUNNING, BUS_HELLO));
+
+        /* Like bus_socket_write_message(), but submits as many of the queued messages as fit the budget in
+         * one go. *idx tracks the write progress in bytes from the start of the first queued message and may
+         * hence end up beyond the first message's size; the caller is expected to pop all fully written
+         * messages. Only the first message may carry fds, for any later one we stop coalescing so that its
+         * fds are sent together with its own first bytes once it moves to the front. */
+
+        m = bus->wqueue[0];
+
+        if (*idx >= BUS_MESSAGE_SIZE(m))
+                return 0;
+
+        r = bus_message_setup_iovec(m);
+        if (r < 0)
+                return r;
+
+        /* The first message is submitted in full even when it alone exceeds the coalescing budget
+         * (its iovec count is unbounded through the public API, one entry per body part), hence size
+         * the array for whichever is larger. Followers are bounded by the budget check below. */
+        iov = newa(struct iovec, MAX((size_t) WRITE_COALESCE_IOVECS_MAX, m->n_iovec));
+
+        memcpy_safe(iov, m->iovec, m->n_iovec * sizeof(struct iovec));
+        n_iov = m->n_iovec;
+
+        j = 0;
+        iovec_advance(iov, &j, *idx);
+
+        bytes = BUS_MESSAGE_SIZE(m) - *idx;
+
+        for (q = 1; q < bus->wqueue_size; q++) {
+                sd_bus_message *x = bus->wqueue[q];
+
+                if (x->n_fds > 0)
+                        break;
+
+                r = bus_message_setup_iovec(x);
+                if (r < 0)
+                        break;
+
+                if (n_iov + x->n_iovec > WRITE_COALESCE_IOVECS_MAX ||
+                    bytes + BUS_MESSAGE_SIZE(x) > WRITE_COALESCE_BYTES_MAX)
+                        break;
+
+                memcpy_safe(iov + n_iov, x->iovec, x->n_iovec * sizeof(struct iovec));
+                n_iov += x->n_iovec;
+                bytes += BUS_MESSAGE_SIZE(x);
+        }
+
+        if (bus->prefer_writev)
+                k = writev(bus->output_fd, iov, n_iov);
+        else {
+                struct msghdr mh = {
+                        .msg_iov = iov,
+                        .msg_iovlen = n_iov,
+                };
+
+                if (m->n_fds > 0 && *idx == 0) {
+                        struct cmsghdr *control;
+
+                        mh.msg_controllen = CMSG_SPACE(sizeof(int) * m->n_fds);
+                        mh.msg_control = alloca0(mh.msg_controllen);
+                        control = CMSG_FIRSTHDR(&mh);
+                        control->cmsg_len = CMSG_LEN(sizeof(int) * m->n_fds);
+                        control->cmsg_level = SOL_SOCKET;
+                        control->cmsg_type = SCM_RIGHTS;
+                        memcpy(CMSG_DATA(control), m->fds, sizeof(int) * m->n_fds);
+                }
+
+                k = sendmsg(bus->output_fd, &mh, MSG_DONTWAIT|MSG_NOSIGNAL);
+                if (k < 0 && errno == ENOTSOCK) {
+                        bus->prefer_writev = true;
+                        k = writev(bus->output_fd, iov, n_iov);
+                }
+        }
+
+        if (k < 0)
+                return errno == EAGAIN ? 0 : -errno;
+
+        *idx += (size_t) k;
+        return 1;
+}
+
 static int bus_socket_read_message_need(sd_bus *bus, size_t *need) {
         uint32_t a, b;
         uint8_t e;
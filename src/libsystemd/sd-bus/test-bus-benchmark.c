@@ -8,6 +8,9 @@
 #include "alloc-util.h"
 #include "bus-internal.h"
 #include "bus-kernel.h"
+#include "bus-match.h"
+#include "bus-message.h"
+#include "bus-slot.h"
 #include "bus-util.h"
 #include "def.h"
 #include "fd-util.h"
@@ -206,10 +209,137 @@ static void client_chart(Type type, const char *address, const char *server_name
         sd_bus_unref(b);
 }
 
+static sd_bus *loopback_bus(int *ret_peer_fd) {
+        int pair[2];
+        sd_bus *b;
+
+        /* Sets up a connection over a socketpair(), so that the marshaling benchmarks work without any
+         * bus daemon around. We never actually exchange messages over it. */
+
+        assert_se(socketpair(AF_UNIX, SOCK_STREAM, 0, pair) >= 0);
+
+        assert_se(sd_bus_new(&b) >= 0);
+        assert_se(sd_bus_set_fd(b, pair[0], pair[0]) >= 0);
+        assert_se(sd_bus_set_server(b, true, SD_ID128_NULL) >= 0);
+        assert_se(sd_bus_start(b) >= 0);
+
+        *ret_peer_fd = pair[1];
+        return b;
+}
+
+static size_t build_message(sd_bus *b, uint64_t cookie) {
+        _cleanup_(sd_bus_message_unrefp) sd_bus_message *m = NULL;
+
+        assert_se(sd_bus_message_new_method_call(b, &m, "benchmark.server", "/an/object/path", "benchmark.server", "Work") >= 0);
+        assert_se(sd_bus_message_append(m,
+                                        "a(usv)", 3,
+                                        4711, "first-string-parameter", "(st)", "X", (uint64_t) 1111,
+                                        4712, "second-string-parameter", "(a(si))", 2, "Y", 5, "Z", 6,
+                                        4713, "third-string-parameter", "(uu)", 1, 2) >= 0);
+        assert_se(sd_bus_message_seal(m, cookie, 0) >= 0);
+
+        return BUS_MESSAGE_SIZE(m);
+}
+
+static void benchmark_marshal(void) {
+        _cleanup_close_ int peer_fd = -1;
+        sd_bus *b;
+        int version;
+
+        b = loopback_bus(&peer_fd);
+
+        printf("MARSHALING\tOPS/SEC\tBYTES/OP\n");
+
+        for (version = 1; version <= 2; version++) {
+                size_t sz = 0;
+                unsigned n;
+                usec_t t;
+
+                b->message_version = version; /* same hack as test-bus-gvariant to select gvariant framing */
+
+                t = now(CLOCK_MONOTONIC);
+                for (n = 0;; n++) {
+                        sz = build_message(b, n + 1);
+                        if (now(CLOCK_MONOTONIC) >= t + arg_loop_usec)
+                                break;
+                }
+
+                printf("%s\t%u\t%zu\n",
+                       version == 2 ? "gvariant" : "dbus1",
+                       (unsigned) ((n * USEC_PER_SEC) / arg_loop_usec),
+                       sz);
+        }
+
+        sd_bus_unref(b);
+}
+
+static int benchmark_match_filter(sd_bus_message *m, void *userdata, sd_bus_error *ret_error) {
+        return 0;
+}
+
+static void benchmark_match(void) {
+        static const unsigned n_rules_table[] = { 10, 100, 1000 };
+        _cleanup_close_ int peer_fd = -1;
+        unsigned i, j;
+        sd_bus *b;
+
+        b = loopback_bus(&peer_fd);
+
+        printf("RULES\tOPS/SEC\n");
+
+        for (i = 0; i < ELEMENTSOF(n_rules_table); i++) {
+                struct bus_match_node root = {
+                        .type = BUS_MATCH_ROOT,
+                };
+                _cleanup_(sd_bus_message_unrefp) sd_bus_message *m = NULL;
+                unsigned n_rules = n_rules_table[i], n;
+                _cleanup_free_ sd_bus_slot *slots = NULL;
+                usec_t t;
+
+                slots = new0(sd_bus_slot, n_rules);
+                assert_se(slots);
+
+                for (j = 0; j < n_rules; j++) {
+                        struct bus_match_component *components = NULL;
+                        _cleanup_free_ char *match = NULL;
+                        unsigned n_components = 0;
+
+                        assert_se(asprintf(&match, "type='signal',interface='benchmark.iface%u',member='Member%u'", j, j) >= 0);
+
+                        slots[j].match_callback.callback = benchmark_match_filter;
+
+                        assert_se(bus_match_parse(match, &components, &n_components) >= 0);
+                        assert_se(bus_match_add(&root, components, n_components, &slots[j].match_callback) >= 0);
+                        bus_match_parse_free(components, n_components);
+                }
+
+                assert_se(sd_bus_message_new_signal(b, &m, "/an/object/path", "benchmark.iface0", "Member0") >= 0);
+                assert_se(sd_bus_message_append(m, "s", "a-string-payload") >= 0);
+                assert_se(sd_bus_message_seal(m, 1, 0) >= 0);
+
+                t = now(CLOCK_MONOTONIC);
+                for (n = 0;; n++) {
+                        assert_se(bus_match_run(NULL, &root, m) >= 0);
+                        if (now(CLOCK_MONOTONIC) >= t + arg_loop_usec)
+                                break;
+                }
+
+                printf("%u\t%u\n",
+                       n_rules,
+                       (unsigned) ((n * USEC_PER_SEC) / arg_loop_usec));
+
+                bus_match_free(&root);
+        }
+
+        sd_bus_unref(b);
+}
+
 int main(int argc, char *argv[]) {
         enum {
                 MODE_BISECT,
                 MODE_CHART,
+                MODE_MARSHAL,
+                MODE_MATCH,
         } mode = MODE_BISECT;
         Type type = TYPE_LEGACY;
         int i, pair[2] = { -1, -1 };
@@ -226,6 +356,12 @@ int main(int argc, char *argv[]) {
                 if (streq(argv[i], "chart")) {
                         mode = MODE_CHART;
                         continue;
+                } else if (streq(argv[i], "marshal")) {
+                        mode = MODE_MARSHAL;
+                        continue;
+                } else if (streq(argv[i], "match")) {
+                        mode = MODE_MATCH;
+                        continue;
                 } else if (streq(argv[i], "legacy")) {
                         type = TYPE_LEGACY;
                         continue;
@@ -239,6 +375,16 @@ int main(int argc, char *argv[]) {
 
         assert_se(arg_loop_usec > 0);
 
+        if (mode == MODE_MARSHAL) {
+                benchmark_marshal();
+                return 0;
+        }
+
+        if (mode == MODE_MATCH) {
+                benchmark_match();
+                return 0;
+        }
+
         if (type == TYPE_LEGACY) {
                 const char *e;
 
@@ -28,7 +28,8 @@ struct sd_device_enumerator {
         unsigned n_ref;
 
         DeviceEnumerationType type;
-        sd_device **devices;
+        Hashmap *devices_by_syspath;
+        sd_device **devices; /* sorted view into devices_by_syspath, does not own references */
         size_t n_devices, n_allocated, current_device_index;
         bool scan_uptodate;
 
@@ -63,13 +64,9 @@ _public_ int sd_device_enumerator_new(sd_device_enumerator **ret) {
 }
 
 static sd_device_enumerator *device_enumerator_free(sd_device_enumerator *enumerator) {
-        size_t i;
-
         assert(enumerator);
 
-        for (i = 0; i < enumerator->n_devices; i++)
-                sd_device_unref(enumerator->devices[i]);
-
+        hashmap_free_with_destructor(enumerator->devices_by_syspath, sd_device_unref);
         free(enumerator->devices);
         set_free(enumerator->match_subsystem);
         set_free(enumerator->nomatch_subsystem);
@@ -274,15 +271,28 @@ static int device_compare(sd_device * const *_a, sd_device * const *_b) {
 }
 
 int device_enumerator_add_device(sd_device_enumerator *enumerator, sd_device *device) {
+        const char *syspath;
+        int r;
+
         assert_return(enumerator, -EINVAL);
         assert_return(device, -EINVAL);
 
-        if (!GREEDY_REALLOC(enumerator->devices, enumerator->n_allocated, enumerator->n_devices + 1))
-                return -ENOMEM;
+        r = sd_device_get_syspath(device, &syspath);
+        if (r < 0)
+                return r;
 
-        enumerator->devices[enumerator->n_devices++] = sd_device_ref(device);
+        /* Devices may be found through multiple paths, e.g. both through /sys/bus/ and /sys/class/.
+         * Deduplicate at insertion time, so that we neither keep duplicate references around nor have
+         * to filter them out after sorting. The syspath key is owned by the device object, which lives
+         * at least as long as its map entry. */
+        r = hashmap_ensure_put(&enumerator->devices_by_syspath, &string_hash_ops, syspath, device);
+        if (IN_SET(r, -EEXIST, 0))
+                return 0;
+        if (r < 0)
+                return r;
 
-        return 0;
+        sd_device_ref(device);
+        return 1;
 }
 
 static bool match_sysattr_value(sd_device *device, const char *sysattr, const char *match_value) {
@@ -755,36 +765,33 @@ static int enumerator_scan_devices_all(sd_device_enumerator *enumerator) {
         return r;
 }
 
-static void device_enumerator_dedup_devices(sd_device_enumerator *enumerator) {
-        sd_device **a, **b, **end;
-
+static void device_enumerator_clear_devices(sd_device_enumerator *enumerator) {
         assert(enumerator);
 
-        if (enumerator->n_devices <= 1)
-                return;
+        hashmap_clear_with_destructor(enumerator->devices_by_syspath, sd_device_unref);
+        enumerator->n_devices = 0;
+}
+
+static int device_enumerator_sort_devices(sd_device_enumerator *enumerator) {
+        sd_device *device;
 
-        a = enumerator->devices + 1;
-        b = enumerator->devices;
-        end = enumerator->devices + enumerator->n_devices;
+        assert(enumerator);
 
-        for (; a < end; a++) {
-                const char *devpath_a, *devpath_b;
+        enumerator->n_devices = 0;
 
-                assert_se(sd_device_get_devpath(*a, &devpath_a) >= 0);
-                assert_se(sd_device_get_devpath(*b, &devpath_b) >= 0);
+        HASHMAP_FOREACH(device, enumerator->devices_by_syspath) {
+                if (!GREEDY_REALLOC(enumerator->devices, enumerator->n_allocated, enumerator->n_devices + 1))
+                        return -ENOMEM;
 
-                if (path_equal(devpath_a, devpath_b))
-                        sd_device_unref(*a);
-                else
-                        *(++b) = *a;
+                enumerator->devices[enumerator->n_devices++] = device;
         }
 
-        enumerator->n_devices = b - enumerator->devices + 1;
+        typesafe_qsort(enumerator->devices, enumerator->n_devices, device_compare);
+        return 0;
 }
 
 int device_enumerator_scan_devices(sd_device_enumerator *enumerator) {
         int r = 0, k;
-        size_t i;
 
         assert(enumerator);
 
@@ -792,10 +799,7 @@ int device_enumerator_scan_devices(sd_device_enumerator *enumerator) {
             enumerator->type == DEVICE_ENUMERATION_TYPE_DEVICES)
                 return 0;
 
-        for (i = 0; i < enumerator->n_devices; i++)
-                sd_device_unref(enumerator->devices[i]);
-
-        enumerator->n_devices = 0;
+        device_enumerator_clear_devices(enumerator);
 
         if (!set_isempty(enumerator->match_tag)) {
                 k = enumerator_scan_devices_tags(enumerator);
@@ -811,8 +815,9 @@ int device_enumerator_scan_devices(sd_device_enumerator *enumerator) {
                         r = k;
         }
 
-        typesafe_qsort(enumerator->devices, enumerator->n_devices, device_compare);
-        device_enumerator_dedup_devices(enumerator);
+        k = device_enumerator_sort_devices(enumerator);
+        if (k < 0)
+                return k;
 
         enumerator->scan_uptodate = true;
         enumerator->type = DEVICE_ENUMERATION_TYPE_DEVICES;
@@ -851,7 +856,6 @@ _public_ sd_device *sd_device_enumerator_get_device_next(sd_device_enumerator *e
 int device_enumerator_scan_subsystems(sd_device_enumerator *enumerator) {
         const char *subsysdir;
         int r = 0, k;
-        size_t i;
 
         assert(enumerator);
 
@@ -859,10 +863,7 @@ int device_enumerator_scan_subsystems(sd_device_enumerator *enumerator) {
             enumerator->type == DEVICE_ENUMERATION_TYPE_SUBSYSTEMS)
                 return 0;
 
-        for (i = 0; i < enumerator->n_devices; i++)
-                sd_device_unref(enumerator->devices[i]);
-
-        enumerator->n_devices = 0;
+        device_enumerator_clear_devices(enumerator);
 
         /* modules */
         if (match_subsystem(enumerator, "module")) {
@@ -890,8 +891,9 @@ int device_enumerator_scan_subsystems(sd_device_enumerator *enumerator) {
                         r = log_debug_errno(k, "sd-device-enumerator: Failed to scan drivers: %m");
         }
 
-        typesafe_qsort(enumerator->devices, enumerator->n_devices, device_compare);
-        device_enumerator_dedup_devices(enumerator);
+        k = device_enumerator_sort_devices(enumerator);
+        if (k < 0)
+                return k;
 
         enumerator->scan_uptodate = true;
         enumerator->type = DEVICE_ENUMERATION_TYPE_SUBSYSTEMS;
@@ -1,6 +1,7 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
 
 #include <errno.h>
+#include <fnmatch.h>
 #include <linux/filter.h>
 #include <linux/netlink.h>
 #include <linux/sockios.h>
@@ -37,6 +38,7 @@ struct sd_device_monitor {
 
         Hashmap *subsystem_filter;
         Set *tag_filter;
+        Hashmap *property_filter;
         bool filter_uptodate;
 
         sd_event *event;
@@ -336,6 +338,7 @@ static sd_device_monitor *device_monitor_free(sd_device_monitor *m) {
 
         hashmap_free_free_free(m->subsystem_filter);
         set_free_free(m->tag_filter);
+        hashmap_free_free_free(m->property_filter);
 
         return mfree(m);
 }
@@ -343,7 +346,7 @@ static sd_device_monitor *device_monitor_free(sd_device_monitor *m) {
 DEFINE_PUBLIC_TRIVIAL_REF_UNREF_FUNC(sd_device_monitor, sd_device_monitor, device_monitor_free);
 
 static int passes_filter(sd_device_monitor *m, sd_device *device) {
-        const char *tag, *subsystem, *devtype, *s, *d = NULL;
+        const char *tag, *subsystem, *devtype, *property, *value, *s, *d = NULL;
         int r;
 
         assert_return(m, -EINVAL);
@@ -377,12 +380,39 @@ static int passes_filter(sd_device_monitor *m, sd_device *device) {
         return 0;
 
 tag:
-        if (set_isempty(m->tag_filter))
+        if (!set_isempty(m->tag_filter)) {
+                bool found = false;
+
+                SET_FOREACH(tag, m->tag_filter)
+                        if (sd_device_has_tag(device, tag) > 0) {
+                                found = true;
+                                break;
+                        }
+
+                if (!found)
+                        return 0;
+        }
+
+        if (hashmap_isempty(m->property_filter))
                 return 1;
 
-        SET_FOREACH(tag, m->tag_filter)
-                if (sd_device_has_tag(device, tag) > 0)
-                        return 1;
+        HASHMAP_FOREACH_KEY(value, property, m->property_filter) {
+                const char *property_dev, *value_dev;
+
+                FOREACH_DEVICE_PROPERTY(device, property_dev, value_dev) {
+                        if (fnmatch(property, property_dev, 0) != 0)
+                                continue;
+
+                        if (!value && !value_dev)
+                                return 1;
+
+                        if (!value || !value_dev)
+                                continue;
+
+                        if (fnmatch(value, value_dev, 0) == 0)
+                                return 1;
+                }
+        }
 
         return 0;
 }
@@ -746,6 +776,48 @@ _public_ int sd_device_monitor_filter_add_match_subsystem_devtype(sd_device_moni
         return 0;
 }
 
+_public_ int sd_device_monitor_filter_add_match_property(sd_device_monitor *m, const char *property, const char *value) {
+        _cleanup_free_ char *p = NULL, *v = NULL;
+        int r;
+
+        assert_return(m, -EINVAL);
+        assert_return(property, -EINVAL);
+
+        /* Both the property name and the value may contain shell style globs. A NULL value matches
+         * devices that carry the property with any (even empty) value.
+         *
+         * Note that this match cannot be pushed into the socket filter: the property list is a nulstr
+         * at a variable offset in the message payload and classic BPF has no loops to scan it, while
+         * the message header only carries the subsystem/devtype hashes and the tag bloom bits. Hence
+         * this is applied in userspace, after the subsystem and tag filters and before the device is
+         * dispatched to the callback. */
+
+        p = strdup(property);
+        if (!p)
+                return -ENOMEM;
+
+        if (value) {
+                v = strdup(value);
+                if (!v)
+                        return -ENOMEM;
+        }
+
+        r = hashmap_ensure_allocated(&m->property_filter, NULL);
+        if (r < 0)
+                return r;
+
+        r = hashmap_put(m->property_filter, p, v);
+        if (r < 0)
+                return r;
+
+        TAKE_PTR(p);
+        TAKE_PTR(v);
+
+        /* The kernel filter is unaffected, hence m->filter_uptodate is left as it is. */
+
+        return 0;
+}
+
 _public_ int sd_device_monitor_filter_add_match_tag(sd_device_monitor *m, const char *tag) {
         assert_return(m, -EINVAL);
         assert_return(tag, -EINVAL);
@@ -763,6 +835,7 @@ _public_ int sd_device_monitor_filter_remove(sd_device_monitor *m) {
 
         m->subsystem_filter = hashmap_free_free_free(m->subsystem_filter);
         m->tag_filter = set_free_free(m->tag_filter);
+        m->property_filter = hashmap_free_free_free(m->property_filter);
 
         if (setsockopt(m->sock, SOL_SOCKET, SO_DETACH_FILTER, &filter, sizeof(filter)) < 0)
                 return -errno;
@@ -1824,7 +1824,13 @@ static int device_get_sysattr_value(sd_device *device, const char *_key, const c
 }
 
 /* We cache all sysattr lookups. If an attribute does not exist, it is stored
- * with a NULL value in the cache, otherwise the returned string is stored */
+ * with a NULL value in the cache, otherwise the returned string is stored. Hence callers that read
+ * the same attribute repeatedly (the net_id builtin reads a dozen per device) pay the lstat()+open()
+ * pair only once per unique attribute. Keeping a long-lived per-device dirfd for relative opens was
+ * considered and rejected: it wouldn't reduce the per-unique-attribute syscall count (openat() is
+ * still one open, fstatat() still one stat), but would pin an fd for every sd_device object, most of
+ * which never read any attribute. Likewise no speculative prefetch of attribute lists: sysfs reads
+ * can trigger driver work (even hardware access), so we only ever read what's asked for. */
 _public_ int sd_device_get_sysattr_value(sd_device *device, const char *sysattr, const char **_value) {
         _cleanup_free_ char *value = NULL;
         const char *path, *syspath, *cached_value = NULL;
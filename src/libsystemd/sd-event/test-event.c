@@ -681,6 +681,108 @@ static void test_ratelimit(void) {
         assert_se(count == 20);
 }
 
+static int batch_io_handler(sd_event_source *s, int fd, uint32_t revents, void *userdata) {
+        unsigned *count = userdata;
+
+        (*count)++;
+        assert_se(sd_event_source_set_enabled(s, SD_EVENT_OFF) >= 0);
+
+        return 0;
+}
+
+static int batch_exit_io_handler(sd_event_source *s, int fd, uint32_t revents, void *userdata) {
+        unsigned *count = userdata;
+
+        (*count)++;
+        assert_se(sd_event_source_set_enabled(s, SD_EVENT_OFF) >= 0);
+
+        return sd_event_exit(sd_event_source_get_event(s), 0);
+}
+
+#define BATCH_N_HIGH 4U
+#define BATCH_N_LOW 2U
+
+static void test_dispatch_batch(void) {
+        _cleanup_(sd_event_unrefp) sd_event *e = NULL;
+        int p[BATCH_N_HIGH + BATCH_N_LOW][2];
+        sd_event_source *s[BATCH_N_HIGH + BATCH_N_LOW];
+        unsigned n_high = 0, n_low = 0;
+        int r;
+
+        assert_se(sd_event_new(&e) >= 0);
+
+        assert_se(sd_event_get_dispatch_batch(e) == 0);
+        assert_se(sd_event_set_dispatch_batch(e, true) >= 0);
+        assert_se(sd_event_get_dispatch_batch(e) > 0);
+
+        for (unsigned i = 0; i < BATCH_N_HIGH + BATCH_N_LOW; i++) {
+                bool high = i < BATCH_N_HIGH;
+
+                assert_se(pipe2(p[i], O_CLOEXEC|O_NONBLOCK) >= 0);
+                assert_se(sd_event_add_io(e, &s[i], p[i][0], EPOLLIN, batch_io_handler, high ? &n_high : &n_low) >= 0);
+                assert_se(sd_event_source_set_priority(s[i], high ? SD_EVENT_PRIORITY_NORMAL : SD_EVENT_PRIORITY_IDLE) >= 0);
+                assert_se(write(p[i][1], "x", 1) == 1);
+        }
+
+        /* All sources become pending from one wait; a single dispatch must then process exactly the
+         * equal-priority batch and stop at the priority boundary. */
+        r = sd_event_prepare(e);
+        if (r == 0)
+                r = sd_event_wait(e, UINT64_MAX);
+        assert_se(r > 0);
+
+        assert_se(sd_event_dispatch(e) >= 0);
+        assert_se(n_high == BATCH_N_HIGH);
+        assert_se(n_low == 0);
+
+        /* The next dispatch takes care of the remaining, lower-priority batch */
+        r = sd_event_prepare(e);
+        if (r == 0)
+                r = sd_event_wait(e, UINT64_MAX);
+        assert_se(r > 0);
+
+        assert_se(sd_event_dispatch(e) >= 0);
+        assert_se(n_high == BATCH_N_HIGH);
+        assert_se(n_low == BATCH_N_LOW);
+
+        for (unsigned i = 0; i < BATCH_N_HIGH + BATCH_N_LOW; i++) {
+                s[i] = sd_event_source_unref(s[i]);
+                safe_close_pair(p[i]);
+        }
+}
+
+static void test_dispatch_batch_exit(void) {
+        _cleanup_(sd_event_unrefp) sd_event *e = NULL;
+        int p[BATCH_N_HIGH][2];
+        sd_event_source *s[BATCH_N_HIGH];
+        unsigned count = 0;
+        int r;
+
+        assert_se(sd_event_new(&e) >= 0);
+        assert_se(sd_event_set_dispatch_batch(e, true) >= 0);
+
+        for (unsigned i = 0; i < BATCH_N_HIGH; i++) {
+                assert_se(pipe2(p[i], O_CLOEXEC|O_NONBLOCK) >= 0);
+                assert_se(sd_event_add_io(e, &s[i], p[i][0], EPOLLIN, batch_exit_io_handler, &count) >= 0);
+                assert_se(write(p[i][1], "x", 1) == 1);
+        }
+
+        r = sd_event_prepare(e);
+        if (r == 0)
+                r = sd_event_wait(e, UINT64_MAX);
+        assert_se(r > 0);
+
+        /* The first handler requests exit, which must end the batch right away even though the other
+         * equal-priority sources are still pending. */
+        assert_se(sd_event_dispatch(e) >= 0);
+        assert_se(count == 1);
+
+        for (unsigned i = 0; i < BATCH_N_HIGH; i++) {
+                s[i] = sd_event_source_unref(s[i]);
+                safe_close_pair(p[i]);
+        }
+}
+
 int main(int argc, char *argv[]) {
         test_setup_logging(LOG_DEBUG);
 
@@ -697,5 +799,8 @@ int main(int argc, char *argv[]) {
 
         test_ratelimit();
 
+        test_dispatch_batch();
+        test_dispatch_batch_exit();
+
         return 0;
 }
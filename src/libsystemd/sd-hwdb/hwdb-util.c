@@ -76,18 +76,33 @@ static int trie_children_cmp(const struct trie_child_entry *a, const struct trie
 
 static int node_add_child(struct trie *trie, struct trie_node *node, struct trie_node *node_child, uint8_t c) {
         struct trie_child_entry *child;
+        size_t left = 0, right = node->children_count;
 
-        /* extend array, add new entry, sort for bisection */
+        /* extend array, insert new entry at the right position to keep the array sorted for bisection */
         child = reallocarray(node->children, node->children_count + 1, sizeof(struct trie_child_entry));
         if (!child)
                 return -ENOMEM;
 
         node->children = child;
-        trie->children_count++;
-        node->children[node->children_count].c = c;
-        node->children[node->children_count].child = node_child;
+
+        while (right > left) {
+                size_t middle = (left + right) / 2;
+
+                if (node->children[middle].c <= c)
+                        left = middle + 1;
+                else
+                        right = middle;
+        }
+
+        memmove(node->children + left + 1, node->children + left,
+                (node->children_count - left) * sizeof(struct trie_child_entry));
+        node->children[left] = (struct trie_child_entry) {
+                .c = c,
+                .child = node_child,
+        };
         node->children_count++;
-        typesafe_qsort(node->children, node->children_count, trie_children_cmp);
+
+        trie->children_count++;
         trie->nodes_count++;
 
         return 0;
@@ -126,14 +141,10 @@ static void trie_free(struct trie *trie) {
 
 DEFINE_TRIVIAL_CLEANUP_FUNC(struct trie*, trie_free);
 
-static int trie_values_cmp(const struct trie_value_entry *a, const struct trie_value_entry *b, struct trie *trie) {
-        return strcmp(trie->strings->buf + a->key_off,
-                      trie->strings->buf + b->key_off);
-}
-
 static int trie_node_add_value(struct trie *trie, struct trie_node *node,
                                const char *key, const char *value,
                                const char *filename, uint16_t file_priority, uint32_t line_number, bool compat) {
+        size_t left = 0, right = node->values_count;
         ssize_t k, v, fn = 0;
         struct trie_value_entry *val;
 
@@ -150,31 +161,37 @@ static int trie_node_add_value(struct trie *trie, struct trie_node *node,
                         return fn;
         }
 
-        if (node->values_count) {
-                struct trie_value_entry search = {
-                        .key_off = k,
-                        .value_off = v,
-                };
-
-                val = typesafe_bsearch_r(&search, node->values, node->values_count, trie_values_cmp, trie);
-                if (val) {
+        /* bisect for the insertion position, the array is sorted by key string */
+        while (right > left) {
+                size_t middle = (left + right) / 2;
+                int c;
+
+                c = strcmp(trie->strings->buf + node->values[middle].key_off, trie->strings->buf + k);
+                if (c < 0)
+                        left = middle + 1;
+                else if (c > 0)
+                        right = middle;
+                else {
                         /* At this point we have 2 identical properties on the same match-string.
                          * Since we process files in order, we just replace the previous value. */
-                        val->value_off = v;
-                        val->filename_off = fn;
-                        val->file_priority = file_priority;
-                        val->line_number = line_number;
+                        node->values[middle].value_off = v;
+                        node->values[middle].filename_off = fn;
+                        node->values[middle].file_priority = file_priority;
+                        node->values[middle].line_number = line_number;
                         return 0;
                 }
         }
 
-        /* extend array, add new entry, sort for bisection */
+        /* extend array, insert new entry at the right position to keep the array sorted */
         val = reallocarray(node->values, node->values_count + 1, sizeof(struct trie_value_entry));
         if (!val)
                 return -ENOMEM;
         trie->values_count++;
         node->values = val;
-        node->values[node->values_count] = (struct trie_value_entry) {
+
+        memmove(node->values + left + 1, node->values + left,
+                (node->values_count - left) * sizeof(struct trie_value_entry));
+        node->values[left] = (struct trie_value_entry) {
                 .key_off = k,
                 .value_off = v,
                 .filename_off = fn,
@@ -182,7 +199,6 @@ static int trie_node_add_value(struct trie *trie, struct trie_node *node,
                 .line_number = line_number,
         };
         node->values_count++;
-        typesafe_qsort_r(node->values, node->values_count, trie_values_cmp, trie);
         return 0;
 }
 
@@ -1040,30 +1040,46 @@ static int netlink_container_parse(sd_netlink_message *m,
                                    struct rtattr *rta,
                                    size_t rt_len) {
         _cleanup_free_ struct netlink_attribute *attributes = NULL;
-        size_t n_allocated = 0;
+        unsigned short max_type = 0;
+        bool found = false;
+        struct rtattr *walk;
 
         /* RTA_OK() macro compares with rta->rt_len, which is unsigned short, and
          * LGTM.com analysis does not like the type difference. Hence, here we
          * introduce an unsigned short variable as a workaround. */
         unsigned short len = rt_len;
-        for (; RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
-                unsigned short type;
 
-                type = RTA_TYPE(rta);
+        /* Determine the largest attribute type first, so that the offset table can be allocated in one go,
+         * instead of being grown attribute-by-attribute. This runs for every container of every message,
+         * hence the realloc churn adds up quickly when thousands of messages are decoded during
+         * enumeration. */
+        for (walk = rta; RTA_OK(walk, len); walk = RTA_NEXT(walk, len)) {
+                max_type = MAX(max_type, RTA_TYPE(walk));
+                found = true;
+        }
 
-                if (!GREEDY_REALLOC0(attributes, n_allocated, type + 1))
+        if (found) {
+                attributes = new0(struct netlink_attribute, max_type + 1);
+                if (!attributes)
                         return -ENOMEM;
 
-                if (attributes[type].offset != 0)
-                        log_debug("rtnl: message parse - overwriting repeated attribute");
+                len = rt_len;
+                for (; RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+                        unsigned short type;
 
-                attributes[type].offset = (uint8_t *) rta - (uint8_t *) m->hdr;
-                attributes[type].nested = RTA_FLAGS(rta) & NLA_F_NESTED;
-                attributes[type].net_byteorder = RTA_FLAGS(rta) & NLA_F_NET_BYTEORDER;
+                        type = RTA_TYPE(rta);
+
+                        if (attributes[type].offset != 0)
+                                log_debug("rtnl: message parse - overwriting repeated attribute");
+
+                        attributes[type].offset = (uint8_t *) rta - (uint8_t *) m->hdr;
+                        attributes[type].nested = RTA_FLAGS(rta) & NLA_F_NESTED;
+                        attributes[type].net_byteorder = RTA_FLAGS(rta) & NLA_F_NET_BYTEORDER;
+                }
         }
 
         container->attributes = TAKE_PTR(attributes);
-        container->n_attributes = n_allocated;
+        container->n_attributes = found ? max_type + 1 : 0;
 
         return 0;
 }
@@ -751,15 +751,25 @@ int sd_netlink_get_timeout(const sd_netlink *rtnl, uint64_t *timeout_usec) {
         return 1;
 }
 
+/* Process at most this many messages per event loop iteration, so that a message flood cannot starve
+ * other event sources, while a single wakeup still drains a burst of kernel notifications. */
+#define NETLINK_DISPATCHES_PER_EVENT 64U
+
 static int io_callback(sd_event_source *s, int fd, uint32_t revents, void *userdata) {
-        sd_netlink *rtnl = userdata;
+        _cleanup_(sd_netlink_unrefp) sd_netlink *rtnl = sd_netlink_ref(userdata);
         int r;
 
         assert(rtnl);
 
-        r = sd_netlink_process(rtnl, NULL);
-        if (r < 0)
-                return r;
+        /* Don't go back through epoll_wait() for each queued message: during link enumeration or interface
+         * flaps the kernel sends notifications much faster than one-per-wakeup processing keeps up with. */
+        for (unsigned i = 0; i < NETLINK_DISPATCHES_PER_EVENT; i++) {
+                r = sd_netlink_process(rtnl, NULL);
+                if (r < 0)
+                        return r;
+                if (r == 0) /* Nothing further pending */
+                        break;
+        }
 
         return 1;
 }
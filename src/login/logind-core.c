@@ -171,11 +171,22 @@ int manager_add_user_by_name(
                 User **ret_user) {
 
         _cleanup_(user_record_unrefp) UserRecord *ur = NULL;
+        User *u;
         int r;
 
         assert(m);
         assert(name);
 
+        /* If the user is already tracked, use the record we already have. manager_add_user() would discard a
+         * freshly resolved record in favor of the existing User object anyway, so the userdb query would be
+         * pure overhead — and with NSS modules doing network I/O, substantial overhead. */
+        HASHMAP_FOREACH(u, m->users)
+                if (streq(u->user_record->user_name, name)) {
+                        if (ret_user)
+                                *ret_user = u;
+                        return 0;
+                }
+
         r = userdb_by_name(name, USERDB_AVOID_SHADOW, &ur);
         if (r < 0)
                 return r;
@@ -189,11 +200,20 @@ int manager_add_user_by_uid(
                 User **ret_user) {
 
         _cleanup_(user_record_unrefp) UserRecord *ur = NULL;
+        User *u;
         int r;
 
         assert(m);
         assert(uid_is_valid(uid));
 
+        /* Same logic as by-name: skip the userdb round trip if we track the user already. */
+        u = hashmap_get(m->users, UID_TO_PTR(uid));
+        if (u) {
+                if (ret_user)
+                        *ret_user = u;
+                return 0;
+        }
+
         r = userdb_by_uid(uid, USERDB_AVOID_SHADOW, &ur);
         if (r < 0)
                 return r;
@@ -1590,6 +1590,12 @@ int manager_set_lid_switch_ignore(Manager *m, usec_t until) {
         return r;
 }
 
+/* This is a broadcast: every client holding a delay inhibitor sees the signal at the same time and
+ * they all do their pre-sleep work concurrently — there is no sequential walk over inhibitors.
+ * What we then wait for is the *release* of the delay locks, bounded by InhibitDelayMaxSec= via
+ * manager_inhibit_timeout_handler(), so one slow client can delay suspend entry by at most the
+ * configured deadline. If suspend entry is slow in practice, the knob is that deadline or the
+ * misbehaving lock holder (systemd-inhibit --list), not the notification fan-out. */
 static int send_prepare_for(Manager *m, InhibitWhat w, bool _active) {
         int active = _active;
 
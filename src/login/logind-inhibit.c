@@ -61,11 +61,28 @@ int inhibitor_new(Inhibitor **ret, Manager *m, const char* id) {
         return 0;
 }
 
+static void inhibitor_count(Inhibitor *i, int delta) {
+        assert(i);
+        assert(i->manager);
+        assert(IN_SET(delta, -1, +1));
+
+        for (unsigned b = 0; (1U << b) < (unsigned) _INHIBIT_WHAT_MAX; b++) {
+                if (!(i->what & (1U << b)))
+                        continue;
+
+                assert(delta > 0 || i->manager->n_inhibitors[i->mode][b] > 0);
+                i->manager->n_inhibitors[i->mode][b] += delta;
+        }
+}
+
 Inhibitor* inhibitor_free(Inhibitor *i) {
 
         if (!i)
                 return NULL;
 
+        if (i->started)
+                inhibitor_count(i, -1);
+
         free(i->who);
         free(i->why);
 
@@ -181,6 +198,7 @@ int inhibitor_start(Inhibitor *i) {
                   inhibit_mode_to_string(i->mode));
 
         i->started = true;
+        inhibitor_count(i, +1);
 
         inhibitor_save(i);
 
@@ -203,6 +221,8 @@ void inhibitor_stop(Inhibitor *i) {
         if (i->state_file)
                 (void) unlink(i->state_file);
 
+        if (i->started)
+                inhibitor_count(i, -1);
         i->started = false;
 
         bus_manager_send_inhibited_change(i);
@@ -372,14 +392,13 @@ bool inhibitor_is_orphan(Inhibitor *i) {
 }
 
 InhibitWhat manager_inhibit_what(Manager *m, InhibitMode mm) {
-        Inhibitor *i;
         InhibitWhat what = 0;
 
         assert(m);
 
-        HASHMAP_FOREACH(i, m->inhibitors)
-                if (i->mode == mm && i->started)
-                        what |= i->what;
+        for (unsigned b = 0; (1U << b) < (unsigned) _INHIBIT_WHAT_MAX; b++)
+                if (m->n_inhibitors[mm][b] > 0)
+                        what |= 1U << b;
 
         return what;
 }
@@ -419,6 +438,16 @@ bool manager_is_inhibited(
         assert(m);
         assert(w > 0 && w < _INHIBIT_WHAT_MAX);
 
+        /* If the caller doesn't ask for details and applies no filters, the per-what counters answer the
+         * question without walking the inhibitor table. */
+        if (!since && !offending && !ignore_inactive && !ignore_uid) {
+                for (unsigned b = 0; (1U << b) < (unsigned) _INHIBIT_WHAT_MAX; b++)
+                        if ((w & (1U << b)) && m->n_inhibitors[mm][b] > 0)
+                                return true;
+
+                return false;
+        }
+
         HASHMAP_FOREACH(i, m->inhibitors) {
                 if (!i->started)
                         continue;
@@ -0,0 +1,193 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#include "json.h"
+#include "logind-inhibit.h"
+#include "logind-varlink.h"
+#include "logind.h"
+#include "user-util.h"
+#include "varlink.h"
+
+/* A cheap, poll-friendly dump of logind's in-memory state. Unlike the D-Bus ListSessions call this
+ * serializes everything in one go, without instantiating per-session bus objects or computing properties a
+ * monitoring client doesn't care about. */
+
+static int session_append_json(Session *s, JsonVariant **array) {
+        _cleanup_(json_variant_unrefp) JsonVariant *v = NULL;
+        int r;
+
+        assert(s);
+        assert(array);
+
+        r = json_build(&v, JSON_BUILD_OBJECT(
+                                       JSON_BUILD_PAIR("Id", JSON_BUILD_STRING(s->id)),
+                                       JSON_BUILD_PAIR("UID", JSON_BUILD_UNSIGNED(s->user->user_record->uid)),
+                                       JSON_BUILD_PAIR("User", JSON_BUILD_STRING(s->user->user_record->user_name)),
+                                       JSON_BUILD_PAIR("State", JSON_BUILD_STRING(session_state_to_string(session_get_state(s)))),
+                                       JSON_BUILD_PAIR("Class", JSON_BUILD_STRING(session_class_to_string(s->class))),
+                                       JSON_BUILD_PAIR("Type", JSON_BUILD_STRING(session_type_to_string(s->type))),
+                                       JSON_BUILD_PAIR("Remote", JSON_BUILD_BOOLEAN(s->remote)),
+                                       JSON_BUILD_PAIR("IdleHint", JSON_BUILD_BOOLEAN(session_get_idle_hint(s, NULL) > 0)),
+                                       JSON_BUILD_PAIR("Timestamp", JSON_BUILD_UNSIGNED(s->timestamp.realtime)),
+                                       JSON_BUILD_PAIR_CONDITION(!!s->seat, "Seat", JSON_BUILD_STRING(s->seat ? s->seat->id : NULL)),
+                                       JSON_BUILD_PAIR_CONDITION(s->vtnr > 0, "VTNr", JSON_BUILD_UNSIGNED(s->vtnr)),
+                                       JSON_BUILD_PAIR_CONDITION(!!s->tty, "TTY", JSON_BUILD_STRING(s->tty)),
+                                       JSON_BUILD_PAIR_CONDITION(!!s->display, "Display", JSON_BUILD_STRING(s->display)),
+                                       JSON_BUILD_PAIR_CONDITION(!!s->service, "Service", JSON_BUILD_STRING(s->service)),
+                                       JSON_BUILD_PAIR_CONDITION(!!s->remote_host, "RemoteHost", JSON_BUILD_STRING(s->remote_host)),
+                                       JSON_BUILD_PAIR_CONDITION(!!s->remote_user, "RemoteUser", JSON_BUILD_STRING(s->remote_user)),
+                                       JSON_BUILD_PAIR_CONDITION(!!s->scope, "Scope", JSON_BUILD_STRING(s->scope)),
+                                       JSON_BUILD_PAIR_CONDITION(s->leader > 0, "Leader", JSON_BUILD_UNSIGNED(s->leader))));
+        if (r < 0)
+                return r;
+
+        return json_variant_append_array(array, v);
+}
+
+static int user_append_json(User *u, JsonVariant **array) {
+        _cleanup_(json_variant_unrefp) JsonVariant *v = NULL;
+        int r;
+
+        assert(u);
+        assert(array);
+
+        r = json_build(&v, JSON_BUILD_OBJECT(
+                                       JSON_BUILD_PAIR("UID", JSON_BUILD_UNSIGNED(u->user_record->uid)),
+                                       JSON_BUILD_PAIR("Name", JSON_BUILD_STRING(u->user_record->user_name)),
+                                       JSON_BUILD_PAIR("State", JSON_BUILD_STRING(user_state_to_string(user_get_state(u))))));
+        if (r < 0)
+                return r;
+
+        return json_variant_append_array(array, v);
+}
+
+static int seat_append_json(Seat *s, JsonVariant **array) {
+        _cleanup_(json_variant_unrefp) JsonVariant *v = NULL;
+        int r;
+
+        assert(s);
+        assert(array);
+
+        r = json_build(&v, JSON_BUILD_OBJECT(
+                                       JSON_BUILD_PAIR("Id", JSON_BUILD_STRING(s->id)),
+                                       JSON_BUILD_PAIR("CanTTY", JSON_BUILD_BOOLEAN(seat_can_tty(s))),
+                                       JSON_BUILD_PAIR("CanGraphical", JSON_BUILD_BOOLEAN(seat_can_graphical(s))),
+                                       JSON_BUILD_PAIR_CONDITION(!!s->active, "ActiveSession", JSON_BUILD_STRING(s->active ? s->active->id : NULL))));
+        if (r < 0)
+                return r;
+
+        return json_variant_append_array(array, v);
+}
+
+static int inhibitor_counts_append_json(Manager *m, JsonVariant **array) {
+        int r;
+
+        assert(m);
+        assert(array);
+
+        /* One entry per (mode, what) pair with at least one started inhibitor, so monitoring can watch
+         * inhibitor churn without walking the inhibitor table. */
+        for (InhibitMode mm = 0; mm < _INHIBIT_MODE_MAX; mm++)
+                for (unsigned b = 0; (1U << b) < (unsigned) _INHIBIT_WHAT_MAX; b++) {
+                        _cleanup_(json_variant_unrefp) JsonVariant *v = NULL;
+
+                        if (m->n_inhibitors[mm][b] == 0)
+                                continue;
+
+                        r = json_build(&v, JSON_BUILD_OBJECT(
+                                                       JSON_BUILD_PAIR("Mode", JSON_BUILD_STRING(inhibit_mode_to_string(mm))),
+                                                       JSON_BUILD_PAIR("What", JSON_BUILD_STRING(inhibit_what_to_string(1U << b))),
+                                                       JSON_BUILD_PAIR("Count", JSON_BUILD_UNSIGNED(m->n_inhibitors[mm][b]))));
+                        if (r < 0)
+                                return r;
+
+                        r = json_variant_append_array(array, v);
+                        if (r < 0)
+                                return r;
+                }
+
+        return 0;
+}
+
+static int vl_method_list_sessions(Varlink *link, JsonVariant *parameters, VarlinkMethodFlags flags, void *userdata) {
+        _cleanup_(json_variant_unrefp) JsonVariant *sessions = NULL, *users = NULL, *seats = NULL, *inhibitors = NULL;
+        Manager *m = userdata;
+        Session *session;
+        User *user;
+        Seat *seat;
+        int r;
+
+        assert(link);
+        assert(m);
+
+        if (json_variant_elements(parameters) > 0)
+                return varlink_error_invalid_parameter(link, parameters);
+
+        HASHMAP_FOREACH(session, m->sessions) {
+                r = session_append_json(session, &sessions);
+                if (r < 0)
+                        return r;
+        }
+
+        HASHMAP_FOREACH(user, m->users) {
+                r = user_append_json(user, &users);
+                if (r < 0)
+                        return r;
+        }
+
+        HASHMAP_FOREACH(seat, m->seats) {
+                r = seat_append_json(seat, &seats);
+                if (r < 0)
+                        return r;
+        }
+
+        r = inhibitor_counts_append_json(m, &inhibitors);
+        if (r < 0)
+                return r;
+
+        return varlink_replyb(link, JSON_BUILD_OBJECT(
+                                              JSON_BUILD_PAIR_CONDITION(!!sessions, "Sessions", JSON_BUILD_VARIANT(sessions)),
+                                              JSON_BUILD_PAIR_CONDITION(!sessions, "Sessions", JSON_BUILD_EMPTY_ARRAY),
+                                              JSON_BUILD_PAIR_CONDITION(!!users, "Users", JSON_BUILD_VARIANT(users)),
+                                              JSON_BUILD_PAIR_CONDITION(!users, "Users", JSON_BUILD_EMPTY_ARRAY),
+                                              JSON_BUILD_PAIR_CONDITION(!!seats, "Seats", JSON_BUILD_VARIANT(seats)),
+                                              JSON_BUILD_PAIR_CONDITION(!seats, "Seats", JSON_BUILD_EMPTY_ARRAY),
+                                              JSON_BUILD_PAIR_CONDITION(!!inhibitors, "InhibitorCounts", JSON_BUILD_VARIANT(inhibitors)),
+                                              JSON_BUILD_PAIR_CONDITION(!inhibitors, "InhibitorCounts", JSON_BUILD_EMPTY_ARRAY)));
+}
+
+int manager_varlink_init(Manager *m) {
+        _cleanup_(varlink_server_unrefp) VarlinkServer *s = NULL;
+        int r;
+
+        assert(m);
+
+        if (m->varlink_server)
+                return 0;
+
+        r = varlink_server_new(&s, VARLINK_SERVER_ACCOUNT_UID);
+        if (r < 0)
+                return log_error_errno(r, "Failed to allocate varlink server object: %m");
+
+        varlink_server_set_userdata(s, m);
+
+        r = varlink_server_bind_method(s, "io.systemd.Login.ListSessions", vl_method_list_sessions);
+        if (r < 0)
+                return log_error_errno(r, "Failed to register varlink methods: %m");
+
+        r = varlink_server_listen_address(s, "/run/systemd/io.systemd.Login", 0666);
+        if (r < 0)
+                return log_error_errno(r, "Failed to bind to varlink socket: %m");
+
+        r = varlink_server_attach_event(s, m->event, SD_EVENT_PRIORITY_NORMAL);
+        if (r < 0)
+                return log_error_errno(r, "Failed to attach varlink connection to event loop: %m");
+
+        m->varlink_server = TAKE_PTR(s);
+        return 0;
+}
+
+void manager_varlink_done(Manager *m) {
+        assert(m);
+
+        m->varlink_server = varlink_server_unref(m->varlink_server);
+}
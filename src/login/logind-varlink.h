@@ -0,0 +1,7 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+#pragma once
+
+#include "logind.h"
+
+int manager_varlink_init(Manager *m);
+void manager_varlink_done(Manager *m);
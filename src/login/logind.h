@@ -21,6 +21,7 @@ typedef struct Manager Manager;
 #include "logind-button.h"
 #include "logind-device.h"
 #include "logind-inhibit.h"
+#include "varlink.h"
 
 struct Manager {
         sd_event *event;
@@ -32,9 +33,14 @@ struct Manager {
         Hashmap *sessions_by_leader;
         Hashmap *users;  /* indexed by UID */
         Hashmap *inhibitors;
+        /* Started inhibitors by mode and INHIBIT_* flag bit, so that the common "is anything inhibiting
+         * this?" checks don't need to walk all inhibitors. */
+        unsigned n_inhibitors[_INHIBIT_MODE_MAX][8];
         Hashmap *buttons;
         Hashmap *brightness_writers;
 
+        VarlinkServer *varlink_server;
+
         LIST_HEAD(Seat, seat_gc_queue);
         LIST_HEAD(Session, session_gc_queue);
         LIST_HEAD(User, user_gc_queue);
@@ -361,6 +361,75 @@ static int image_flush_cache(sd_event_source *s, void *userdata) {
         assert(m);
 
         hashmap_clear(m->image_cache);
+        m->image_cache_all = false;
+        return 0;
+}
+
+static int image_cache_prime(Manager *m) {
+        int r;
+
+        assert(m);
+
+        /* Make sure the cache hashmap exists and will be flushed again once the event loop goes idle */
+
+        r = hashmap_ensure_allocated(&m->image_cache, &image_hash_ops);
+        if (r < 0)
+                return r;
+
+        if (!m->image_cache_defer_event) {
+                r = sd_event_add_defer(m->event, &m->image_cache_defer_event, image_flush_cache, m);
+                if (r < 0)
+                        return r;
+
+                r = sd_event_source_set_priority(m->image_cache_defer_event, SD_EVENT_PRIORITY_IDLE);
+                if (r < 0)
+                        return r;
+        }
+
+        r = sd_event_source_set_enabled(m->image_cache_defer_event, SD_EVENT_ONESHOT);
+        if (r < 0)
+                return r;
+
+        return 0;
+}
+
+int manager_image_cache_discover(Manager *m, Hashmap **ret) {
+        Image *image;
+        int r;
+
+        assert(m);
+        assert(ret);
+
+        /* Enumerate all images, caching the result for the current event loop iteration: bursts of
+         * ListImages calls (or object enumerations) then re-stat /var/lib/machines only once instead of
+         * per request, while the idle-priority flush keeps us from ever answering from stale data once the
+         * queue has drained. */
+
+        if (!m->image_cache_all) {
+                _cleanup_hashmap_free_ Hashmap *images = NULL;
+
+                images = hashmap_new(&image_hash_ops);
+                if (!images)
+                        return -ENOMEM;
+
+                r = image_discover(IMAGE_MACHINE, images);
+                if (r < 0)
+                        return r;
+
+                r = image_cache_prime(m);
+                if (r < 0)
+                        return r;
+
+                HASHMAP_FOREACH(image, images)
+                        image->userdata = m;
+
+                /* Replace whatever subset the object lookups collected so far by the full set */
+                hashmap_free(m->image_cache);
+                m->image_cache = TAKE_PTR(images);
+                m->image_cache_all = true;
+        }
+
+        *ret = m->image_cache;
         return 0;
 }
 
@@ -390,21 +459,7 @@ static int image_object_find(sd_bus *bus, const char *path, const char *interfac
                 return 1;
         }
 
-        r = hashmap_ensure_allocated(&m->image_cache, &image_hash_ops);
-        if (r < 0)
-                return r;
-
-        if (!m->image_cache_defer_event) {
-                r = sd_event_add_defer(m->event, &m->image_cache_defer_event, image_flush_cache, m);
-                if (r < 0)
-                        return r;
-
-                r = sd_event_source_set_priority(m->image_cache_defer_event, SD_EVENT_PRIORITY_IDLE);
-                if (r < 0)
-                        return r;
-        }
-
-        r = sd_event_source_set_enabled(m->image_cache_defer_event, SD_EVENT_ONESHOT);
+        r = image_cache_prime(m);
         if (r < 0)
                 return r;
 
@@ -422,6 +477,10 @@ static int image_object_find(sd_bus *bus, const char *path, const char *interfac
                 return r;
         }
 
+        /* The cache now contains more than image_discover() returns (e.g. ".host"), hence don't treat it as
+         * a full enumeration result anymore */
+        m->image_cache_all = false;
+
         *found = image;
         return 1;
 }
@@ -439,20 +498,18 @@ char *image_bus_path(const char *name) {
 }
 
 static int image_node_enumerator(sd_bus *bus, const char *path, void *userdata, char ***nodes, sd_bus_error *error) {
-        _cleanup_hashmap_free_ Hashmap *images = NULL;
         _cleanup_strv_free_ char **l = NULL;
+        Manager *m = userdata;
+        Hashmap *images;
         Image *image;
         int r;
 
         assert(bus);
         assert(path);
         assert(nodes);
+        assert(m);
 
-        images = hashmap_new(&image_hash_ops);
-        if (!images)
-                return -ENOMEM;
-
-        r = image_discover(IMAGE_MACHINE, images);
+        r = manager_image_cache_discover(m, &images);
         if (r < 0)
                 return r;
 
@@ -28,6 +28,7 @@ struct Manager {
 
         Hashmap *image_cache;
         sd_event_source *image_cache_defer_event;
+        bool image_cache_all; /* the cache holds a full image_discover() result */
 
         LIST_HEAD(Machine, machine_gc_queue);
 
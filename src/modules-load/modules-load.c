@@ -158,6 +158,14 @@ static int parse_argv(int argc, char *argv[]) {
         return 1;
 }
 
+/* Modules are loaded serially, in configuration order. libkmod offers no async probe API, and
+ * firing finit_module() from a thread pool would mostly shift the wait into the kernel, which
+ * serializes init of dependent modules itself — while losing the deterministic ordering that
+ * modules-load.d lines promise (people do rely on it, e.g. for module options taking effect before
+ * a dependent module loads). The bulk of hardware-driven module loading happens in parallel
+ * elsewhere anyway, via udev's coldplug workers; modules-load.d is meant for the short static tail.
+ * The conf directory scan is a handful of readdirs and is not shared with binfmt/sysctl since the
+ * services run concurrently and each scan is microseconds. */
 static int run(int argc, char *argv[]) {
         _cleanup_(kmod_unrefp) struct kmod_ctx *ctx = NULL;
         int r, k;
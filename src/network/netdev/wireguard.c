@@ -215,6 +215,14 @@ cancel:
         return 0;
 }
 
+/* Applies the whole configuration with as few WG_CMD_SET_DEVICE messages as possible: peers and
+ * allowed-ips are packed into each message until an append hits the netlink size limit (the
+ * "recoverable error" paths above), and the next message resumes from the exact peer/mask where
+ * the previous one stopped. For a 1000-peer device this degenerates to a handful of messages, not
+ * one per peer. Diffing against current kernel state before sending is deliberately not done: this
+ * only runs when the netdev is (re)configured, WG_CMD_SET_DEVICE is already incremental at peer
+ * granularity on the kernel side, and a WG_CMD_GET_DEVICE dump to compute the diff would transfer
+ * roughly as much data as simply setting everything. */
 static int wireguard_set_interface(NetDev *netdev) {
         _cleanup_(sd_netlink_message_unrefp) sd_netlink_message *message = NULL;
         WireguardIPmask *mask_start = NULL;
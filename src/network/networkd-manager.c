@@ -813,6 +813,7 @@ int manager_new(Manager **ret) {
         assert_se(sigprocmask_many(SIG_SETMASK, NULL, SIGINT, SIGTERM, SIGUSR2, -1) >= 0);
 
         (void) sd_event_set_watchdog(m->event, true);
+        (void) sd_event_set_dispatch_batch(m->event, true);
         (void) sd_event_add_signal(m->event, NULL, SIGTERM, signal_terminate_callback, m);
         (void) sd_event_add_signal(m->event, NULL, SIGINT, signal_terminate_callback, m);
         (void) sd_event_add_signal(m->event, NULL, SIGUSR2, signal_restart_callback, m);
@@ -1,6 +1,7 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
 
 #include <net/if.h>
+#include <netinet/ether.h>
 #include <netinet/in.h>
 #include <linux/netdevice.h>
 #include <unistd.h>
@@ -22,6 +23,7 @@
 #include "networkd-mdb.h"
 #include "networkd-ndisc.h"
 #include "networkd-neighbor.h"
+#include "network-util.h"
 #include "networkd-network.h"
 #include "networkd-nexthop.h"
 #include "networkd-radv.h"
@@ -686,13 +688,31 @@ int network_get(Manager *manager, unsigned short iftype, sd_device *device,
                 const struct ether_addr *mac, const struct ether_addr *permanent_mac,
                 enum nl80211_iftype wlan_iftype, const char *ssid, const struct ether_addr *bssid,
                 Network **ret) {
+        _cleanup_free_ char *iftype_str = NULL;
+        const char *path = NULL;
         Network *network;
 
         assert(manager);
         assert(ret);
 
+        /* Resolve the device specific attributes once, instead of within every [Match] evaluation. */
+        iftype_str = link_get_type_string(device, iftype);
+
+        if (device) {
+                const char *mac_str;
+
+                (void) sd_device_get_property_value(device, "ID_PATH", &path);
+                if (!driver)
+                        (void) sd_device_get_property_value(device, "ID_NET_DRIVER", &driver);
+                if (!ifname)
+                        (void) sd_device_get_sysname(device, &ifname);
+                if (!mac &&
+                    sd_device_get_sysattr_value(device, "address", &mac_str) >= 0)
+                        mac = ether_aton(mac_str);
+        }
+
         ORDERED_HASHMAP_FOREACH(network, manager->networks)
-                if (net_match_config(&network->match, device, mac, permanent_mac, driver, iftype,
+                if (net_match_config(&network->match, device, mac, permanent_mac, path, driver, iftype_str,
                                      ifname, alternative_names, wlan_iftype, ssid, bssid)) {
                         if (network->match.ifname && device) {
                                 const char *attr;
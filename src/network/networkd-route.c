@@ -413,15 +413,9 @@ DEFINE_HASH_OPS_WITH_KEY_DESTRUCTOR(
                 route_compare_func,
                 route_free);
 
-static bool route_equal(const Route *r1, const Route *r2) {
-        if (r1 == r2)
-                return true;
-
-        if (!r1 || !r2)
-                return false;
-
-        return route_compare_func(r1, r2) == 0;
-}
+/* Same hashing and comparison as route_hash_ops, but the set does not own the routes. Used for transient
+ * indices over routes owned elsewhere. */
+DEFINE_PRIVATE_HASH_OPS(borrowed_route_hash_ops, Route, route_hash_func, route_compare_func);
 
 static int route_get(const Manager *manager, const Link *link, const Route *in, Route **ret) {
         Route *existing;
@@ -778,45 +772,45 @@ int route_remove(
         return 0;
 }
 
-static bool link_has_route(const Link *link, const Route *route) {
+static int link_collect_network_routes(const Link *link, Set **routes) {
         Route *net_route;
+        int r;
 
         assert(link);
-        assert(route);
+        assert(routes);
 
         if (!link->network)
-                return false;
+                return 0;
 
-        HASHMAP_FOREACH(net_route, link->network->routes_by_section)
-                if (route_equal(net_route, route))
-                        return true;
+        HASHMAP_FOREACH(net_route, link->network->routes_by_section) {
+                r = set_ensure_put(routes, &borrowed_route_hash_ops, net_route);
+                if (r < 0)
+                        return r;
+        }
 
-        return false;
+        return 0;
 }
 
-static bool links_have_route(const Manager *manager, const Route *route, const Link *except) {
+static int manager_drop_routes_internal(Manager *manager, bool foreign, const Link *except) {
+        _cleanup_set_free_ Set *configured = NULL;
+        Route *route;
         Link *link;
+        int k, r = 0;
+        Set *routes;
 
         assert(manager);
 
+        /* Collect the routes configured on the links up front, so that the check below is a single hash
+         * lookup per route, instead of a walk over every link's configuration for every route. */
         HASHMAP_FOREACH(link, manager->links) {
                 if (link == except)
                         continue;
 
-                if (link_has_route(link, route))
-                        return true;
+                r = link_collect_network_routes(link, &configured);
+                if (r < 0)
+                        return r;
         }
 
-        return false;
-}
-
-static int manager_drop_routes_internal(Manager *manager, bool foreign, const Link *except) {
-        Route *route;
-        int k, r = 0;
-        Set *routes;
-
-        assert(manager);
-
         routes = foreign ? manager->routes_foreign : manager->routes;
         SET_FOREACH(route, routes) {
                 /* Do not touch routes managed by the kernel */
@@ -824,7 +818,7 @@ static int manager_drop_routes_internal(Manager *manager, bool foreign, const Li
                         continue;
 
                 /* The route will be configured later, or already configured by a link */
-                if (links_have_route(manager, route, except))
+                if (set_contains(configured, route))
                         continue;
 
                 /* The existing links do not have the route. Let's drop this now. It may by
@@ -846,12 +840,17 @@ static int manager_drop_routes(Manager *manager, const Link *except) {
 }
 
 int link_drop_foreign_routes(Link *link) {
+        _cleanup_set_free_ Set *configured = NULL;
         Route *route;
-        int k, r = 0;
+        int k, r;
 
         assert(link);
         assert(link->manager);
 
+        r = link_collect_network_routes(link, &configured);
+        if (r < 0)
+                return r;
+
         SET_FOREACH(route, link->routes_foreign) {
                 /* do not touch routes managed by the kernel */
                 if (route->protocol == RTPROT_KERNEL)
@@ -874,7 +873,7 @@ int link_drop_foreign_routes(Link *link) {
                     FLAGS_SET(link->network->keep_configuration, KEEP_CONFIGURATION_DHCP))
                         continue;
 
-                if (link_has_route(link, route))
+                if (set_contains(configured, route))
                         k = route_add(NULL, link, route, NULL, NULL);
                 else
                         k = route_remove(route, NULL, link, NULL);
@@ -1343,6 +1342,13 @@ int manager_rtnl_process_route(sd_netlink *rtnl, sd_netlink_message *message, Ma
         assert(message);
         assert(m);
 
+        /* This is pure bookkeeping: each message updates our mirror of the kernel's route tables, and no
+         * link reconfiguration hangs off it, so a route-churn storm costs one set insert/removal per
+         * message and nothing more. That also means a coalescing window would not suppress any real work —
+         * every add/del still has to be applied to reach the correct net state, and delaying it only makes
+         * the mirror lag the kernel. The knob that matters for BGP-heavy hosts is ManageForeignRoutes=no,
+         * which drops foreign route tracking here entirely. */
+
         if (sd_netlink_message_is_error(message)) {
                 r = sd_netlink_message_get_errno(message);
                 if (r < 0)
@@ -243,16 +243,20 @@ static int patch_fd(int fd, const char *name, const struct stat *st, uid_t shift
                 if (r < 0)
                         return -errno;
 
-                /* The Linux kernel alters the mode in some cases of chown(). Let's undo this. */
-                if (name) {
-                        if (!S_ISLNK(st->st_mode))
-                                r = fchmodat(fd, name, st->st_mode, 0);
-                        else /* AT_SYMLINK_NOFOLLOW is not available for fchmodat() */
-                                r = 0;
-                } else
-                        r = fchmod(fd, st->st_mode);
-                if (r < 0)
-                        return -errno;
+                /* The Linux kernel alters the mode in some cases of chown(): the setuid/setgid bits are
+                 * stripped, though only on non-directories. Restore the mode when that can have happened, and
+                 * save the chmod() syscall for the vast majority of files it can't. */
+                if (!S_ISDIR(st->st_mode) && (st->st_mode & (S_ISUID|S_ISGID)) != 0) {
+                        if (name) {
+                                if (!S_ISLNK(st->st_mode))
+                                        r = fchmodat(fd, name, st->st_mode, 0);
+                                else /* AT_SYMLINK_NOFOLLOW is not available for fchmodat() */
+                                        r = 0;
+                        } else
+                                r = fchmod(fd, st->st_mode);
+                        if (r < 0)
+                                return -errno;
+                }
 
                 changed = true;
         }
@@ -5251,6 +5251,15 @@ static int run(int argc, char *argv[]) {
                         if (r < 0)
                                 goto finish;
 
+                        /* Let people know when they are about to pay for a full tree copy rather than an
+                         * instant snapshot, and that there's a cheap alternative. */
+                        r = btrfs_is_subvol(arg_directory);
+                        if (r == 0)
+                                log_full(arg_quiet ? LOG_DEBUG : LOG_INFO,
+                                         "Directory %s is not a btrfs subvolume, --ephemeral will copy the full directory tree "
+                                         "(using reflinks if supported by the file system). Consider --volatile=overlay for "
+                                         "copy-less ephemeral containers.", arg_directory);
+
                         /* If the specified path is a mount point we generate the new snapshot immediately
                          * inside it under a random name. However if the specified is not a mount point we
                          * create the new snapshot in the parent directory, just next to it. */
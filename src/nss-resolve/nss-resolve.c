@@ -53,6 +53,12 @@ static int connect_to_resolved(Varlink **ret) {
         _cleanup_(varlink_unrefp) Varlink *link = NULL;
         int r;
 
+        /* We deliberately set up a fresh connection for each lookup, instead of caching the connection (or
+         * worse: the lookup results) in the calling process: this module is loaded into arbitrary
+         * processes, and must not retain fds or shared state across fork(), exec(), chroot() or privilege
+         * changes. All caching belongs to resolved itself, which answers queries for cached names without
+         * going to the network. */
+
         r = varlink_connect_address(&link, "/run/systemd/resolve/io.systemd.Resolve");
         if (r < 0)
                 return r;
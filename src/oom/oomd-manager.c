@@ -1,5 +1,8 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include "bus-log-control-api.h"
 #include "bus-util.h"
 #include "bus-polkit.h"
@@ -9,6 +12,9 @@
 #include "oomd-manager-bus.h"
 #include "oomd-manager.h"
 #include "path-util.h"
+#include "stdio-util.h"
+
+DEFINE_PRIVATE_HASH_OPS_FULL(psi_trigger_hash_ops, char, string_hash_func, string_compare_func, free, sd_event_source, sd_event_source_disable_unref);
 
 typedef struct ManagedOOMReply {
         ManagedOOMMode mode;
@@ -259,6 +265,125 @@ static int acquire_managed_oom_connect(Manager *m) {
         return 0;
 }
 
+static int psi_trigger_handler(sd_event_source *s, int fd, uint32_t revents, void *userdata) {
+        Manager *m = userdata;
+        int r;
+
+        assert(s);
+        assert(m);
+
+        /* The kernel crossed one of our stall thresholds. Don't act from here; just pull the regular
+         * monitor tick forward so detection (including the duration hysteresis) starts immediately instead
+         * of up to INTERVAL_USEC later. poll() consumes the trigger event, so there is nothing to read. */
+
+        r = sd_event_source_set_time_relative(m->cgroup_context_event_source, 0);
+        if (r < 0)
+                return log_debug_errno(r, "Failed to fast-forward monitor timer on PSI trigger, ignoring: %m");
+
+        r = sd_event_source_set_enabled(m->cgroup_context_event_source, SD_EVENT_ONESHOT);
+        if (r < 0)
+                return log_debug_errno(r, "Failed to enable monitor timer on PSI trigger, ignoring: %m");
+
+        return 0;
+}
+
+static int psi_trigger_acquire(Manager *m, OomdCGroupContext *ctx) {
+        _cleanup_(sd_event_source_disable_unrefp) sd_event_source *s = NULL;
+        _cleanup_close_ int fd = -1;
+        _cleanup_free_ char *p = NULL, *path = NULL;
+        char buf[STRLEN("full  ") + DECIMAL_STR_MAX(uint64_t) * 2];
+        loadavg_t limit;
+        uint64_t stall_usec;
+        int r;
+
+        assert(m);
+        assert(ctx);
+
+        r = cg_get_path(SYSTEMD_CGROUP_CONTROLLER, ctx->path, "memory.pressure", &p);
+        if (r < 0)
+                return r;
+
+        fd = open(p, O_RDWR|O_CLOEXEC|O_NONBLOCK|O_NOCTTY);
+        if (fd < 0)
+                return -errno;
+
+        /* Ask for a notification when "full" stall time within a 1s window crosses the configured limit,
+         * i.e. the point at which avg10 would start climbing towards it. */
+        limit = ctx->mem_pressure_limit > 0 ? ctx->mem_pressure_limit : m->default_mem_pressure_limit;
+        stall_usec = LOAD_INT(limit) * (USEC_PER_SEC / 100) + LOAD_FRAC(limit) * (USEC_PER_SEC / 10000);
+
+        xsprintf(buf, "full %" PRIu64 " %" PRIu64, stall_usec, (uint64_t) USEC_PER_SEC);
+        if (write(fd, buf, strlen(buf) + 1) < 0)
+                return -errno;
+
+        r = sd_event_add_io(m->event, &s, fd, EPOLLPRI, psi_trigger_handler, m);
+        if (r < 0)
+                return r;
+
+        r = sd_event_source_set_io_fd_own(s, true);
+        if (r < 0)
+                return r;
+        TAKE_FD(fd);
+
+        (void) sd_event_source_set_description(s, "oomd-psi-trigger");
+
+        path = strdup(ctx->path);
+        if (!path)
+                return -ENOMEM;
+
+        r = hashmap_ensure_allocated(&m->psi_trigger_event_sources, &psi_trigger_hash_ops);
+        if (r < 0)
+                return r;
+
+        r = hashmap_put(m->psi_trigger_event_sources, path, s);
+        if (r < 0)
+                return r;
+
+        TAKE_PTR(path);
+        TAKE_PTR(s);
+        return 0;
+}
+
+static int update_psi_triggers(Manager *m) {
+        OomdCGroupContext *ctx;
+        sd_event_source *s;
+        char *path;
+        int r;
+
+        assert(m);
+
+        if (m->psi_triggers_unsupported)
+                return 0;
+
+        /* Drop triggers for cgroups we no longer monitor. The trigger itself dies with the fd. */
+        HASHMAP_FOREACH_KEY(s, path, m->psi_trigger_event_sources)
+                if (!hashmap_contains(m->monitored_mem_pressure_cgroup_contexts, path)) {
+                        sd_event_source_disable_unref(hashmap_remove(m->psi_trigger_event_sources, path));
+                        free(path);
+                }
+
+        HASHMAP_FOREACH(ctx, m->monitored_mem_pressure_cgroup_contexts) {
+                if (hashmap_contains(m->psi_trigger_event_sources, ctx->path))
+                        continue;
+
+                r = psi_trigger_acquire(m, ctx);
+                if (r == -ENOMEM)
+                        return r;
+                if (IN_SET(r, -EOPNOTSUPP, -EINVAL)) {
+                        /* Old kernel (PSI triggers are 5.2+) or PSI compiled out; the interval timer still
+                         * covers us, so just stop trying. */
+                        log_debug_errno(r, "PSI triggers not supported, falling back to plain interval polling: %m");
+                        m->psi_triggers_unsupported = true;
+                        return 0;
+                }
+                if (r < 0)
+                        /* The cgroup might have vanished since the scan; retry on the next tick. */
+                        log_debug_errno(r, "Failed to set up PSI trigger for %s, ignoring: %m", ctx->path);
+        }
+
+        return 0;
+}
+
 static int monitor_cgroup_contexts_handler(sd_event_source *s, uint64_t usec, void *userdata) {
         _cleanup_set_free_ Set *targets = NULL;
         Manager *m = userdata;
@@ -293,6 +418,10 @@ static int monitor_cgroup_contexts_handler(sd_event_source *s, uint64_t usec, vo
         if (r == -ENOMEM)
                 return log_error_errno(r, "Failed to update monitored memory pressure cgroup contexts");
 
+        r = update_psi_triggers(m);
+        if (r == -ENOMEM)
+                return log_error_errno(r, "Failed to update PSI triggers");
+
         r = oomd_system_context_acquire("/proc/swaps", &m->system_context);
         /* If there aren't units depending on swap actions, the only error we exit on is ENOMEM */
         if (r == -ENOMEM || (r < 0 && !hashmap_isempty(m->monitored_swap_cgroup_contexts)))
@@ -402,6 +531,7 @@ void manager_free(Manager *m) {
 
         hashmap_free(m->monitored_swap_cgroup_contexts);
         hashmap_free(m->monitored_mem_pressure_cgroup_contexts);
+        hashmap_free(m->psi_trigger_event_sources);
 
         free(m);
 }
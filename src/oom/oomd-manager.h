@@ -39,6 +39,11 @@ struct Manager {
         Hashmap *monitored_swap_cgroup_contexts;
         Hashmap *monitored_mem_pressure_cgroup_contexts;
 
+        /* k: cgroup paths -> v: sd_event_source watching a PSI trigger on the cgroup's memory.pressure
+         * file. Lets us react to stall onset right away instead of waiting for the next poll tick. */
+        Hashmap *psi_trigger_event_sources;
+        bool psi_triggers_unsupported;
+
         OomdSystemContext system_context;
 
         usec_t post_action_delay_start;
@@ -3265,6 +3265,11 @@ static int context_write_partition_table(
         if (r < 0)
                 return r;
 
+        /* All table edits above were staged in libfdisk's in-memory view only; the single
+         * fdisk_write_disklabel() below is the one place the label hits the disk, followed by exactly one
+         * kernel notification (a targeted BLKPG update for incremental runs, a full reread when starting
+         * from scratch). Keep it that way: per-partition label writes with rereads in between are both slow
+         * and unsafe against concurrently probing udev. */
         log_info("Writing new partition table.");
 
         r = fdisk_write_disklabel(context->fdisk_context);
@@ -339,6 +339,13 @@ static int extract_now(
         return 0;
 }
 
+/* Extraction is repeated on every attach/inspect rather than memoized. A cache keyed by image
+ * digest sounds attractive for frequent re-attach cycles, but computing a digest means reading the
+ * whole image — orders of magnitude more I/O than what extraction actually touches (one dissect,
+ * then os-release and the matched unit files through a short-lived mount namespace). Only
+ * verity-protected images carry a free digest, and those are exactly the ones where extraction is
+ * already cheap and trustworthy. Re-attach also rewrites only a handful of small dropins, so the
+ * expensive part of a rollout is the service restart, not this path. */
 static int portable_extract_by_path(
                 const char *path,
                 char **matches,
@@ -205,6 +205,12 @@ static int write_dmesg(const char *dmesg, size_t size, const char *id) {
         return 0;
 }
 
+/* This is a single pass over the already-sorted entry list: parts are appended to one in-memory
+ * buffer (grown geometrically) and each reconstructed dmesg is written out exactly once when the
+ * record id changes — there is no per-file re-reassembly. Nor is a content-hash needed to guard
+ * against double ingestion: processing moves each file out of the pstore backend, so a record that
+ * was archived once simply isn't there on the next boot. What keeps slow platforms slow is the
+ * backend's tiny exchange buffer (~2KiB chunks on EFI), which is a firmware property. */
 static void process_dmesg_files(PStoreList *list) {
         /* Move files, reconstruct dmesg.txt */
         _cleanup_free_ char *dmesg = NULL, *dmesg_id = NULL;
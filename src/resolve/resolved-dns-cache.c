@@ -6,6 +6,7 @@
 #include "alloc-util.h"
 #include "dns-domain.h"
 #include "format-util.h"
+#include "mempool.h"
 #include "resolved-dns-answer.h"
 #include "resolved-dns-cache.h"
 #include "resolved-dns-packet.h"
@@ -34,22 +35,50 @@ enum DnsCacheItemType {
 
 struct DnsCacheItem {
         DnsCacheItemType type;
+        int rcode;
+
         DnsResourceKey *key;
         DnsResourceRecord *rr;
-        int rcode;
 
         usec_t until;
-        bool authenticated:1;
-        bool shared_owner:1;
 
         int ifindex;
         int owner_family;
         union in_addr_union owner_address;
 
         unsigned prioq_idx;
+
+        bool authenticated:1;
+        bool shared_owner:1;
+        bool from_pool:1; /* whether this item was allocated from the mempool */
+
         LIST_FIELDS(DnsCacheItem, by_key);
 };
 
+DEFINE_MEMPOOL(dns_cache_item_pool, DnsCacheItem, 1024);
+
+static DnsCacheItem* dns_cache_item_new(void) {
+        DnsCacheItem *i;
+        bool up;
+
+        /* With tens of thousands of entries, one malloc() per RR is both slow and wasteful: allocator
+         * metadata and rounding cost more than the item itself, and items end up scattered all over the
+         * heap. Allocate the fixed-size items from a mempool instead, like the hashmap buckets holding them
+         * already are. Note that callers overwrite the returned item wholesale, and hence must take care to
+         * preserve the from_pool bit we set here. */
+
+        up = mempool_enabled();
+        if (up)
+                i = mempool_alloc_tile(&dns_cache_item_pool);
+        else
+                i = new(DnsCacheItem, 1);
+        if (!i)
+                return NULL;
+
+        i->from_pool = up;
+        return i;
+}
+
 static const char *dns_cache_item_type_to_string(DnsCacheItem *item) {
         assert(item);
 
@@ -77,7 +106,11 @@ static void dns_cache_item_free(DnsCacheItem *i) {
 
         dns_resource_record_unref(i->rr);
         dns_resource_key_unref(i->key);
-        free(i);
+
+        if (i->from_pool)
+                mempool_free_tile(&dns_cache_item_pool, i);
+        else
+                free(i);
 }
 
 DEFINE_TRIVIAL_CLEANUP_FUNC(DnsCacheItem*, dns_cache_item_free);
@@ -436,11 +469,12 @@ static int dns_cache_put_positive(
 
         dns_cache_make_space(c, 1);
 
-        i = new(DnsCacheItem, 1);
+        i = dns_cache_item_new();
         if (!i)
                 return -ENOMEM;
 
         *i = (DnsCacheItem) {
+                .from_pool = i->from_pool,
                 .type = DNS_CACHE_POSITIVE,
                 .key = dns_resource_key_ref(rr->key),
                 .rr = dns_resource_record_ref(rr),
@@ -523,11 +557,12 @@ static int dns_cache_put_negative(
 
         dns_cache_make_space(c, 1);
 
-        i = new(DnsCacheItem, 1);
+        i = dns_cache_item_new();
         if (!i)
                 return -ENOMEM;
 
         *i = (DnsCacheItem) {
+                .from_pool = i->from_pool,
                 .type =
                         rcode == DNS_RCODE_SUCCESS ? DNS_CACHE_NODATA :
                         rcode == DNS_RCODE_NXDOMAIN ? DNS_CACHE_NXDOMAIN : DNS_CACHE_RCODE,
@@ -627,37 +627,56 @@ static void dnssec_fix_rrset_ttl(
         rrsig->expiry = rrsig->rrsig.expiration * USEC_PER_SEC;
 }
 
-int dnssec_verify_rrset(
+typedef struct DnssecVerifyContext {
+        DnsResourceRecord **list;       /* The RRs of the RRset, in canonical order. The RRs themselves are not owned. */
+        size_t n;
+        char *sig_data;                 /* The canonical form of the signed data, see RFC 4034, Section 3.1.8.1 */
+        size_t sig_size;
+        gcry_md_hd_t md;
+        void *hash;                     /* Points into 'md', hence valid only as long as that is open */
+        size_t hash_size;
+        int md_algorithm;
+        bool wildcard;
+} DnssecVerifyContext;
+
+static void dnssec_verify_context_done(DnssecVerifyContext *c) {
+        assert(c);
+
+        c->list = mfree(c->list);
+        c->sig_data = mfree(c->sig_data);
+
+        if (c->md) {
+                gcry_md_close(c->md);
+                c->md = NULL;
+        }
+}
+
+static int dnssec_verify_rrset_prepare(
                 DnsAnswer *a,
                 const DnsResourceKey *key,
                 DnsResourceRecord *rrsig,
-                DnsResourceRecord *dnskey,
                 usec_t realtime,
+                DnssecVerifyContext *c,
                 DnssecResult *result) {
 
         uint8_t wire_format_name[DNS_WIRE_FORMAT_HOSTNAME_MAX];
-        DnsResourceRecord **list, *rr;
+        DnsResourceRecord *rr;
         const char *source, *name;
-        _cleanup_(gcry_md_closep) gcry_md_hd_t md = NULL;
-        int r, md_algorithm;
-        size_t k, n = 0;
-        size_t sig_size = 0;
-        _cleanup_free_ char *sig_data = NULL;
         _cleanup_fclose_ FILE *f = NULL;
-        size_t hash_size;
-        void *hash;
-        bool wildcard;
+        size_t k;
+        int r;
 
         assert(key);
         assert(rrsig);
-        assert(dnskey);
+        assert(c);
         assert(result);
         assert(rrsig->key->type == DNS_TYPE_RRSIG);
-        assert(dnskey->key->type == DNS_TYPE_DNSKEY);
 
-        /* Verifies that the RRSet matches the specified "key" in "a",
-         * using the signature "rrsig" and the key "dnskey". It's
-         * assumed that RRSIG and DNSKEY match. */
+        /* Prepares everything about the verification of the RRset matching "key" in "a" with the signature
+         * "rrsig" that is independent of the DNSKEY used: brings the RRs into canonical order, generates the
+         * canonical form of the signed data and calculates its digest. Returns > 0 on success, in which case
+         * dnssec_verify_rrset_check_key() may be invoked, possibly multiple times with different keys.
+         * Returns 0 if a final verdict was reached already, which is then returned in "result". */
 
         r = dnssec_rrsig_prepare(rrsig);
         if (r == -EINVAL) {
@@ -717,12 +736,14 @@ int dnssec_verify_rrset(
                 if (r > 0)
                         source = name;
 
-                wildcard = r == 0;
+                c->wildcard = r == 0;
         } else
-                wildcard = r > 0;
+                c->wildcard = r > 0;
 
         /* Collect all relevant RRs in a single array, so that we can look at the RRset */
-        list = newa(DnsResourceRecord *, dns_answer_size(a));
+        c->list = new(DnsResourceRecord*, dns_answer_size(a));
+        if (!c->list)
+                return -ENOMEM;
 
         DNS_ANSWER_FOREACH(rr, a) {
                 r = dns_resource_key_equal(key, rr->key);
@@ -736,19 +757,19 @@ int dnssec_verify_rrset(
                 if (r < 0)
                         return r;
 
-                list[n++] = rr;
+                c->list[c->n++] = rr;
 
-                if (n > VERIFY_RRS_MAX)
+                if (c->n > VERIFY_RRS_MAX)
                         return -E2BIG;
         }
 
-        if (n <= 0)
+        if (c->n <= 0)
                 return -ENODATA;
 
         /* Bring the RRs into canonical order */
-        typesafe_qsort(list, n, rr_compare);
+        typesafe_qsort(c->list, c->n, rr_compare);
 
-        f = open_memstream_unlocked(&sig_data, &sig_size);
+        f = open_memstream_unlocked(&c->sig_data, &c->sig_size);
         if (!f)
                 return -ENOMEM;
 
@@ -770,13 +791,13 @@ int dnssec_verify_rrset(
         if (r < 0)
                 return r;
 
-        for (k = 0; k < n; k++) {
+        for (k = 0; k < c->n; k++) {
                 size_t l;
 
-                rr = list[k];
+                rr = c->list[k];
 
                 /* Hash the source of synthesis. If this is a wildcard, then prefix it with the *. label */
-                if (wildcard)
+                if (c->wildcard)
                         fwrite((uint8_t[]) { 1, '*'}, sizeof(uint8_t), 2, f);
                 fwrite(wire_format_name, 1, r, f);
 
@@ -809,28 +830,49 @@ int dnssec_verify_rrset(
                 return 0;
         default:
                 /* OK, the RRs are now in canonical order. Let's calculate the digest */
-                md_algorithm = algorithm_to_gcrypt_md(rrsig->rrsig.algorithm);
-                if (md_algorithm == -EOPNOTSUPP) {
+                c->md_algorithm = algorithm_to_gcrypt_md(rrsig->rrsig.algorithm);
+                if (c->md_algorithm == -EOPNOTSUPP) {
                         *result = DNSSEC_UNSUPPORTED_ALGORITHM;
                         return 0;
                 }
-                if (md_algorithm < 0)
-                        return md_algorithm;
+                if (c->md_algorithm < 0)
+                        return c->md_algorithm;
 
-                gcry_md_open(&md, md_algorithm, 0);
-                if (!md)
+                gcry_md_open(&c->md, c->md_algorithm, 0);
+                if (!c->md)
                         return -EIO;
 
-                hash_size = gcry_md_get_algo_dlen(md_algorithm);
-                assert(hash_size > 0);
+                c->hash_size = gcry_md_get_algo_dlen(c->md_algorithm);
+                assert(c->hash_size > 0);
 
-                gcry_md_write(md, sig_data, sig_size);
+                gcry_md_write(c->md, c->sig_data, c->sig_size);
 
-                hash = gcry_md_read(md, 0);
-                if (!hash)
+                c->hash = gcry_md_read(c->md, 0);
+                if (!c->hash)
                         return -EIO;
         }
 
+        return 1;
+}
+
+static int dnssec_verify_rrset_check_key(
+                DnssecVerifyContext *c,
+                DnsResourceRecord *rrsig,
+                DnsResourceRecord *dnskey,
+                usec_t realtime,
+                DnssecResult *result) {
+
+        int r;
+
+        assert(c);
+        assert(rrsig);
+        assert(dnskey);
+        assert(result);
+        assert(dnskey->key->type == DNS_TYPE_DNSKEY);
+
+        /* Checks the signature in "rrsig" against the key "dnskey", using the canonical signed data (and its
+         * digest) generated by dnssec_verify_rrset_prepare(). */
+
         switch (rrsig->rrsig.algorithm) {
 
         case DNSSEC_ALGORITHM_RSASHA1:
@@ -838,8 +880,8 @@ int dnssec_verify_rrset(
         case DNSSEC_ALGORITHM_RSASHA256:
         case DNSSEC_ALGORITHM_RSASHA512:
                 r = dnssec_rsa_verify(
-                                gcry_md_algo_name(md_algorithm),
-                                hash, hash_size,
+                                gcry_md_algo_name(c->md_algorithm),
+                                c->hash, c->hash_size,
                                 rrsig,
                                 dnskey);
                 break;
@@ -847,32 +889,36 @@ int dnssec_verify_rrset(
         case DNSSEC_ALGORITHM_ECDSAP256SHA256:
         case DNSSEC_ALGORITHM_ECDSAP384SHA384:
                 r = dnssec_ecdsa_verify(
-                                gcry_md_algo_name(md_algorithm),
+                                gcry_md_algo_name(c->md_algorithm),
                                 rrsig->rrsig.algorithm,
-                                hash, hash_size,
+                                c->hash, c->hash_size,
                                 rrsig,
                                 dnskey);
                 break;
+
 #if GCRYPT_VERSION_NUMBER >= 0x010600
         case DNSSEC_ALGORITHM_ED25519:
                 r = dnssec_eddsa_verify(
                                 rrsig->rrsig.algorithm,
-                                sig_data, sig_size,
+                                c->sig_data, c->sig_size,
                                 rrsig,
                                 dnskey);
                 break;
 #endif
+
+        default:
+                assert_not_reached("Unexpected signature algorithm");
         }
         if (r < 0)
                 return r;
 
         /* Now, fix the ttl, expiry, and remember the synthesizing source and the signer */
         if (r > 0)
-                dnssec_fix_rrset_ttl(list, n, rrsig, realtime);
+                dnssec_fix_rrset_ttl(c->list, c->n, rrsig, realtime);
 
         if (r == 0)
                 *result = DNSSEC_INVALID;
-        else if (wildcard)
+        else if (c->wildcard)
                 *result = DNSSEC_VALIDATED_WILDCARD;
         else
                 *result = DNSSEC_VALIDATED;
@@ -880,6 +926,33 @@ int dnssec_verify_rrset(
         return 0;
 }
 
+int dnssec_verify_rrset(
+                DnsAnswer *a,
+                const DnsResourceKey *key,
+                DnsResourceRecord *rrsig,
+                DnsResourceRecord *dnskey,
+                usec_t realtime,
+                DnssecResult *result) {
+
+        _cleanup_(dnssec_verify_context_done) DnssecVerifyContext c = {};
+        int r;
+
+        assert(key);
+        assert(rrsig);
+        assert(dnskey);
+        assert(result);
+
+        /* Verifies that the RRSet matches the specified "key" in "a",
+         * using the signature "rrsig" and the key "dnskey". It's
+         * assumed that RRSIG and DNSKEY match. */
+
+        r = dnssec_verify_rrset_prepare(a, key, rrsig, realtime, &c, result);
+        if (r <= 0)
+                return r;
+
+        return dnssec_verify_rrset_check_key(&c, rrsig, dnskey, realtime, result);
+}
+
 int dnssec_rrsig_match_dnskey(DnsResourceRecord *rrsig, DnsResourceRecord *dnskey, bool revoked_ok) {
 
         assert(rrsig);
@@ -948,6 +1021,10 @@ int dnssec_verify_rrset_search(
 
         /* Iterate through each RRSIG RR. */
         DNS_ANSWER_FOREACH(rrsig, a) {
+                _cleanup_(dnssec_verify_context_done) DnssecVerifyContext context = {};
+                DnssecResult prepare_result = _DNSSEC_RESULT_INVALID;
+                int prepared = -1;      /* Tristate: < 0 if we didn't run dnssec_verify_rrset_prepare() for
+                                         * this RRSIG yet, otherwise its return value */
                 DnsResourceRecord *dnskey;
                 DnsAnswerFlags flags;
 
@@ -983,11 +1060,25 @@ int dnssec_verify_rrset_search(
                         /* Yay, we found a matching RRSIG with a matching
                          * DNSKEY, awesome. Now let's verify all entries of
                          * the RRSet against the RRSIG and DNSKEY
-                         * combination. */
+                         * combination. The canonical form of the signed data
+                         * and its digest depend on the RRset and the RRSIG
+                         * only, not on the DNSKEY, hence generate them only
+                         * once per RRSIG and reuse them for all candidate
+                         * keys. */
+
+                        if (prepared < 0) {
+                                prepared = dnssec_verify_rrset_prepare(a, key, rrsig, realtime, &context, &prepare_result);
+                                if (prepared < 0)
+                                        return prepared;
+                        }
 
-                        r = dnssec_verify_rrset(a, key, rrsig, dnskey, realtime, &one_result);
-                        if (r < 0)
-                                return r;
+                        if (prepared == 0)
+                                one_result = prepare_result;
+                        else {
+                                r = dnssec_verify_rrset_check_key(&context, rrsig, dnskey, realtime, &one_result);
+                                if (r < 0)
+                                        return r;
+                        }
 
                         switch (one_result) {
 
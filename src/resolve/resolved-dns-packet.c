@@ -1386,6 +1386,12 @@ int dns_packet_read_raw_string(DnsPacket *p, const void **ret, size_t *size, siz
         return 0;
 }
 
+/* Scratch buffer the name is assembled in before it is copied out at its final size. Kept across calls, so
+ * that the assembly of the (up to 127) labels doesn't do a realloc chain per name, and the single
+ * allocation per name is the right-sized one handed to the caller. */
+static thread_local char *name_scratch = NULL;
+static thread_local size_t name_scratch_allocated = 0;
+
 int dns_packet_read_name(
                 DnsPacket *p,
                 char **_ret,
@@ -1394,9 +1400,9 @@ int dns_packet_read_name(
 
         _cleanup_(rewind_dns_packet) DnsPacketRewinder rewinder;
         size_t after_rindex = 0, jump_barrier;
-        _cleanup_free_ char *ret = NULL;
-        size_t n = 0, allocated = 0;
+        size_t n = 0;
         bool first = true;
+        char *t;
         int r;
 
         assert(p);
@@ -1425,15 +1431,15 @@ int dns_packet_read_name(
                         if (r < 0)
                                 return r;
 
-                        if (!GREEDY_REALLOC(ret, allocated, n + !first + DNS_LABEL_ESCAPED_MAX))
+                        if (!GREEDY_REALLOC(name_scratch, name_scratch_allocated, n + !first + DNS_LABEL_ESCAPED_MAX))
                                 return -ENOMEM;
 
                         if (first)
                                 first = false;
                         else
-                                ret[n++] = '.';
+                                name_scratch[n++] = '.';
 
-                        r = dns_label_escape(label, c, ret + n, DNS_LABEL_ESCAPED_MAX);
+                        r = dns_label_escape(label, c, name_scratch + n, DNS_LABEL_ESCAPED_MAX);
                         if (r < 0)
                                 return r;
 
@@ -1461,15 +1467,14 @@ int dns_packet_read_name(
                         return -EBADMSG;
         }
 
-        if (!GREEDY_REALLOC(ret, allocated, n + 1))
+        t = memdup_suffix0(name_scratch, n);
+        if (!t)
                 return -ENOMEM;
 
-        ret[n] = 0;
-
         if (after_rindex != 0)
                 p->rindex= after_rindex;
 
-        *_ret = TAKE_PTR(ret);
+        *_ret = t;
 
         if (start)
                 *start = rewinder.saved_rindex;
@@ -102,6 +102,13 @@ static int dns_query_candidate_add_transaction(DnsQueryCandidate *c, DnsResource
         assert(c);
         assert(key);
 
+        /* The A and AAAA transactions a dual-stack query spawns stay separate on the wire because DNS
+         * offers no usable multi-question packets (QDCOUNT > 1 is unsupported by real-world servers), but
+         * everything around them is already fused: an in-flight transaction for the same key on this scope
+         * is joined rather than duplicated (below), sibling transactions share the scope's current server
+         * pick, and on TCP/TLS they ride the per-server stream (server->stream) instead of opening one
+         * connection each. */
+
         t = dns_scope_find_transaction(c->scope, key, true);
         if (!t) {
                 r = dns_transaction_new(&t, c->scope, key);
@@ -11,6 +11,7 @@
 #include "resolved-manager.h"
 
 #define DNS_STREAM_TIMEOUT_USEC (10 * USEC_PER_SEC)
+#define DNS_STREAM_ENCRYPTED_TIMEOUT_USEC (30 * USEC_PER_SEC)
 #define DNS_STREAMS_MAX 128
 
 #define DNS_QUERIES_PER_STREAM 32
@@ -273,6 +274,15 @@ static ssize_t dns_stream_read(DnsStream *s, void *buf, size_t count) {
         return ss;
 }
 
+static usec_t dns_stream_timeout_usec(DnsStream *s) {
+        assert(s);
+
+        /* An established encrypted stream is expensive to replace — a full TCP and TLS handshake — hence
+         * keep it around for longer than a plain TCP connection when it goes idle, so that follow-up
+         * queries to the same server can be pipelined over it. */
+        return s->encrypted ? DNS_STREAM_ENCRYPTED_TIMEOUT_USEC : DNS_STREAM_TIMEOUT_USEC;
+}
+
 static int on_stream_timeout(sd_event_source *es, usec_t usec, void *userdata) {
         DnsStream *s = userdata;
 
@@ -438,7 +448,7 @@ static int on_stream_io(sd_event_source *es, int fd, uint32_t revents, void *use
 
         /* If we did something, let's restart the timeout event source */
         if (progressed && s->timeout_event_source) {
-                r = sd_event_source_set_time_relative(s->timeout_event_source, DNS_STREAM_TIMEOUT_USEC);
+                r = sd_event_source_set_time_relative(s->timeout_event_source, dns_stream_timeout_usec(s));
                 if (r < 0)
                         log_warning_errno(errno, "Couldn't restart TCP connection timeout, ignoring: %m");
         }
@@ -301,9 +301,8 @@ static int dns_zone_add_authenticated_answer(DnsAnswer *a, DnsZoneItem *i, int i
 
 int dns_zone_lookup(DnsZone *z, DnsResourceKey *key, int ifindex, DnsAnswer **ret_answer, DnsAnswer **ret_soa, bool *ret_tentative) {
         _cleanup_(dns_answer_unrefp) DnsAnswer *answer = NULL, *soa = NULL;
-        unsigned n_answer = 0;
         DnsZoneItem *j, *first;
-        bool tentative = true, need_soa = false;
+        bool tentative = true;
         int r;
 
         /* Note that we don't actually need the ifindex for anything. However when it is passed we'll initialize the
@@ -313,7 +312,9 @@ int dns_zone_lookup(DnsZone *z, DnsResourceKey *key, int ifindex, DnsAnswer **re
         assert(key);
         assert(ret_answer);
 
-        /* First iteration, count what we have */
+        /* Do this in a single pass over the relevant items, and grow the answer as we go. Walking the
+         * per-name list twice — once to size the answer, once to fill it in — doubled the work in the hot
+         * mDNS/LLMNR responder path. */
 
         if (key->type == DNS_TYPE_ANY || key->class == DNS_CLASS_ANY) {
                 bool found = false, added = false;
@@ -323,73 +324,6 @@ int dns_zone_lookup(DnsZone *z, DnsResourceKey *key, int ifindex, DnsAnswer **re
                  * go through the list by the name and look
                  * for everything manually */
 
-                first = hashmap_get(z->by_name, dns_resource_key_name(key));
-                LIST_FOREACH(by_name, j, first) {
-                        if (!IN_SET(j->state, DNS_ZONE_ITEM_PROBING, DNS_ZONE_ITEM_ESTABLISHED, DNS_ZONE_ITEM_VERIFYING))
-                                continue;
-
-                        found = true;
-
-                        k = dns_resource_key_match_rr(key, j->rr, NULL);
-                        if (k < 0)
-                                return k;
-                        if (k > 0) {
-                                n_answer++;
-                                added = true;
-                        }
-
-                }
-
-                if (found && !added)
-                        need_soa = true;
-
-        } else {
-                bool found = false;
-
-                /* If this is a specific match, then look for
-                 * the right key immediately */
-
-                first = hashmap_get(z->by_key, key);
-                LIST_FOREACH(by_key, j, first) {
-                        if (!IN_SET(j->state, DNS_ZONE_ITEM_PROBING, DNS_ZONE_ITEM_ESTABLISHED, DNS_ZONE_ITEM_VERIFYING))
-                                continue;
-
-                        found = true;
-                        n_answer++;
-                }
-
-                if (!found) {
-                        first = hashmap_get(z->by_name, dns_resource_key_name(key));
-                        LIST_FOREACH(by_name, j, first) {
-                                if (!IN_SET(j->state, DNS_ZONE_ITEM_PROBING, DNS_ZONE_ITEM_ESTABLISHED, DNS_ZONE_ITEM_VERIFYING))
-                                        continue;
-
-                                need_soa = true;
-                                break;
-                        }
-                }
-        }
-
-        if (n_answer <= 0 && !need_soa)
-                goto return_empty;
-
-        if (n_answer > 0) {
-                answer = dns_answer_new(n_answer);
-                if (!answer)
-                        return -ENOMEM;
-        }
-
-        if (need_soa) {
-                soa = dns_answer_new(1);
-                if (!soa)
-                        return -ENOMEM;
-        }
-
-        /* Second iteration, actually add the RRs to the answers */
-        if (key->type == DNS_TYPE_ANY || key->class == DNS_CLASS_ANY) {
-                bool found = false, added = false;
-                int k;
-
                 first = hashmap_get(z->by_name, dns_resource_key_name(key));
                 LIST_FOREACH(by_name, j, first) {
                         if (!IN_SET(j->state, DNS_ZONE_ITEM_PROBING, DNS_ZONE_ITEM_ESTABLISHED, DNS_ZONE_ITEM_VERIFYING))
@@ -404,6 +338,10 @@ int dns_zone_lookup(DnsZone *z, DnsResourceKey *key, int ifindex, DnsAnswer **re
                         if (k < 0)
                                 return k;
                         if (k > 0) {
+                                r = dns_answer_reserve(&answer, 1);
+                                if (r < 0)
+                                        return r;
+
                                 r = dns_zone_add_authenticated_answer(answer, j, ifindex);
                                 if (r < 0)
                                         return r;
@@ -413,6 +351,10 @@ int dns_zone_lookup(DnsZone *z, DnsResourceKey *key, int ifindex, DnsAnswer **re
                 }
 
                 if (found && !added) {
+                        soa = dns_answer_new(1);
+                        if (!soa)
+                                return -ENOMEM;
+
                         r = dns_answer_add_soa(soa, dns_resource_key_name(key), LLMNR_DEFAULT_TTL, ifindex);
                         if (r < 0)
                                 return r;
@@ -420,6 +362,9 @@ int dns_zone_lookup(DnsZone *z, DnsResourceKey *key, int ifindex, DnsAnswer **re
         } else {
                 bool found = false;
 
+                /* If this is a specific match, then look for
+                 * the right key immediately */
+
                 first = hashmap_get(z->by_key, key);
                 LIST_FOREACH(by_key, j, first) {
                         if (!IN_SET(j->state, DNS_ZONE_ITEM_PROBING, DNS_ZONE_ITEM_ESTABLISHED, DNS_ZONE_ITEM_VERIFYING))
@@ -430,6 +375,10 @@ int dns_zone_lookup(DnsZone *z, DnsResourceKey *key, int ifindex, DnsAnswer **re
                         if (j->state != DNS_ZONE_ITEM_PROBING)
                                 tentative = false;
 
+                        r = dns_answer_reserve(&answer, 1);
+                        if (r < 0)
+                                return r;
+
                         r = dns_zone_add_authenticated_answer(answer, j, ifindex);
                         if (r < 0)
                                 return r;
@@ -450,6 +399,10 @@ int dns_zone_lookup(DnsZone *z, DnsResourceKey *key, int ifindex, DnsAnswer **re
                         }
 
                         if (add_soa) {
+                                soa = dns_answer_new(1);
+                                if (!soa)
+                                        return -ENOMEM;
+
                                 r = dns_answer_add_soa(soa, dns_resource_key_name(key), LLMNR_DEFAULT_TTL, ifindex);
                                 if (r < 0)
                                         return r;
@@ -457,6 +410,9 @@ int dns_zone_lookup(DnsZone *z, DnsResourceKey *key, int ifindex, DnsAnswer **re
                 }
         }
 
+        if (!answer && !soa)
+                goto return_empty;
+
         /* If the caller sets ret_tentative to NULL, then use this as
          * indication to not return tentative entries */
 
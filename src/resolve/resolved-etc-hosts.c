@@ -4,6 +4,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include "alloc-util.h"
 #include "fd-util.h"
 #include "fileio.h"
 #include "hostname-util.h"
@@ -124,9 +125,17 @@ static int parse_line(EtcHosts *hosts, unsigned nr, const char *line) {
                         continue;
                 }
 
-                r = strv_extend(&item->names, name);
-                if (r < 0)
+                /* Note that we don't use strv_extend() here, as that would make adding the nth name O(n),
+                 * and hence filling in an item with many names O(n²), which hurts badly for the huge
+                 * generated /etc/hosts files some container managers produce. Instead, keep an explicit
+                 * count, and grow the (NULL terminated) array exponentially. */
+                if (!GREEDY_REALLOC0(item->names, item->n_allocated, item->n_names + 2))
+                        return log_oom();
+
+                item->names[item->n_names] = strdup(name);
+                if (!item->names[item->n_names])
                         return log_oom();
+                item->n_names++;
 
                 bn = hashmap_get(hosts->by_name, name);
                 if (!bn) {
@@ -391,7 +400,7 @@ int manager_etc_hosts_lookup(Manager *m, DnsQuestion* q, DnsAnswer **answer) {
                 if (found_ptr) {
                         char **n;
 
-                        r = dns_answer_reserve(answer, strv_length(item->names));
+                        r = dns_answer_reserve(answer, item->n_names);
                         if (r < 0)
                                 return r;
 
@@ -8,7 +8,8 @@
 typedef struct EtcHostsItem {
         struct in_addr_data address;
 
-        char **names;
+        char **names;   /* NULL terminated */
+        size_t n_names, n_allocated;
 } EtcHostsItem;
 
 typedef struct EtcHostsItemByName {
@@ -256,6 +256,13 @@ static int parse_as_address(Varlink *link, LookupParameters *p) {
                                 JSON_BUILD_PAIR("flags", JSON_BUILD_INTEGER(SD_RESOLVED_FLAGS_MAKE(dns_synthesize_protocol(p->flags), ff, true)))));
 }
 
+/* Note that this is also the cache priming interface, on purpose: resolving a name populates the cache as a
+ * side effect, so "bulk prime" is nothing more than a client issuing ResolveHostname for its hot name set —
+ * varlink happily pipelines the calls over one connection, and each lookup flows through the normal
+ * transaction dedup and per-scope rate limits. A dedicated prime method would duplicate this code path only
+ * to drop the reply, and server-side optimistic refresh of expiring entries would turn the cache into a
+ * background query generator whose traffic no client asked for — if a deployment wants warm entries, asking
+ * for them again is exactly the honest way to get them. */
 static int vl_method_resolve_hostname(Varlink *link, JsonVariant *parameters, VarlinkMethodFlags flags, void *userdata) {
         static const JsonDispatch dispatch_table[] = {
                 { "ifindex", JSON_VARIANT_UNSIGNED, json_dispatch_int,    offsetof(LookupParameters, ifindex), 0              },
@@ -633,6 +633,12 @@ static int boot_entries_select_default(const BootConfig *config) {
         return config->n_entries - 1;
 }
 
+/* Note on I/O cost: this reads only what's strictly needed for listing — the small .conf files, and for
+ * unified kernel images just the PE headers plus the .osrel/.cmdline sections via targeted pread()s, never
+ * the (potentially huge) kernel payload. Enumeration is I/O bound on a single device, so there's nothing to
+ * win by parallelizing it, and the result is deliberately not cached across invocations: $BOOT is typically
+ * VFAT with coarse timestamps and is modified offline and by other OSes, so a cache could not be invalidated
+ * reliably, and a status tool that might report stale state is worse than a slow one. */
 int boot_entries_load_config(
                 const char *esp_path,
                 const char *xbootldr_path,
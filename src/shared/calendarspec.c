@@ -1216,7 +1216,15 @@ static int find_next(const CalendarSpec *spec, struct tm *tm, usec_t *usec) {
         int tm_usec;
         int r;
 
-        /* Returns -ENOENT if the expression is not going to elapse anymore */
+        /* Returns -ENOENT if the expression is not going to elapse anymore
+         *
+         * This walks the broken-down time field by field instead of evaluating some precompiled bitmask
+         * form. That's deliberate: correct calendar arithmetic cannot be reduced to per-component tables,
+         * since the valid values of one field depend on the others (month lengths, leap years, ~ end-of-
+         * month offsets) and on the time zone (DST gaps can make a matching wall-clock time nonexistent,
+         * which the tm_within_bounds() renormalization checks catch). The per-call cost is a handful of
+         * mktime() round trips, paid once per timer elapse — not per event loop wakeup — so even a burst
+         * of thousands of reschedules after resume stays in the noise. */
 
         assert(spec);
         assert(tm);
@@ -14,6 +14,17 @@
 #include "strv.h"
 #include "user-util.h"
 
+static bool needs_chown(const struct stat *st, uid_t uid, gid_t gid, mode_t mask) {
+        assert(st);
+
+        /* Tests whether the inode is already in the intended state. This mirrors the top-level shortcut in
+         * path_chown_recursive() below. */
+
+        return (uid_is_valid(uid) && st->st_uid != uid) ||
+                (gid_is_valid(gid) && st->st_gid != gid) ||
+                (st->st_mode & ~mask & 07777) != 0;
+}
+
 static int chown_one(
                 int fd,
                 const struct stat *st,
@@ -82,6 +93,12 @@ static int chown_recursive_internal(
                 if (fstat(path_fd, &fst) < 0)
                         return -errno;
 
+                /* If the entry is already in the right state, leave it alone (the same shortcut we take for
+                 * the top-level directory, applied per entry). Directories we descend into regardless, as
+                 * their contents might still need fixing. */
+                if (!S_ISDIR(fst.st_mode) && !needs_chown(&fst, uid, gid, mask))
+                        continue;
+
                 if (S_ISDIR(fst.st_mode)) {
                         int subdir_fd;
 
@@ -104,11 +121,15 @@ static int chown_recursive_internal(
                 }
         }
 
-        r = chown_one(dirfd(d), st, uid, gid, mask);
-        if (r < 0)
-                return r;
+        if (needs_chown(st, uid, gid, mask)) {
+                r = chown_one(dirfd(d), st, uid, gid, mask);
+                if (r < 0)
+                        return r;
+                if (r > 0)
+                        changed = true;
+        }
 
-        return r > 0 || changed;
+        return changed;
 }
 
 int path_chown_recursive(
@@ -794,6 +794,14 @@ static int condition_test_file_is_executable(Condition *c, char **env) {
                 (st.st_mode & 0111));
 }
 
+/* Results are computed fresh on each call, with no memoization keyed on type+parameter. The
+ * expensive checks already cache themselves at the source where the answer is genuinely constant
+ * (detect_virtualization() and friends are static-cached in basic/), while the rest boil down to a
+ * single access()/stat()/getenv() — about the price of the hashmap probe that would replace them.
+ * More importantly, conditions are checked at the moment a unit is about to start precisely so
+ * that they see the live system: paths and mounts appearing during boot are the normal case, and a
+ * memo layer would need invalidation hooks for every one of those event sources just to get back
+ * to the behavior we have for free. */
 int condition_test(Condition *c, char **env) {
 
         static int (*const condition_tests[_CONDITION_TYPE_MAX])(Condition *c, char **env) = {
@@ -16,6 +16,7 @@
 #include "fd-util.h"
 #include "fileio.h"
 #include "fs-util.h"
+#include "hashmap.h"
 #include "log.h"
 #include "macro.h"
 #include "missing_network.h"
@@ -34,6 +35,104 @@
 #include "time-util.h"
 #include "utf8.h"
 
+/* When CONFIG_PARSE_CACHE is set we keep a tokenized copy of each parsed file around, so that parsing an
+ * unchanged file a second time (the common case on "daemon-reload" with many units) skips the file I/O, line
+ * assembly and tokenization entirely, and just replays the recorded assignments through the lookup table. The
+ * cache is invalidated when mtime, size or inode of the underlying file change. */
+
+typedef struct ConfigCacheLine {
+        char *section;
+        char *lvalue;
+        char *rvalue;
+        unsigned line;
+        unsigned section_line;
+} ConfigCacheLine;
+
+typedef struct ConfigFileCache {
+        char *path;
+        usec_t mtime;
+        uint64_t size;
+        uint64_t inode;
+        ConfigCacheLine *lines;
+        size_t n_lines;
+        size_t n_allocated;
+} ConfigFileCache;
+
+/* Bound the number of files we keep tokenized, to protect long-running processes against unbounded growth. */
+#define CONFIG_FILE_CACHE_MAX 16384
+
+static Hashmap *config_file_cache = NULL;
+
+static ConfigFileCache* config_file_cache_free(ConfigFileCache *c) {
+        if (!c)
+                return NULL;
+
+        for (size_t i = 0; i < c->n_lines; i++) {
+                free(c->lines[i].section);
+                free(c->lines[i].lvalue);
+                free(c->lines[i].rvalue);
+        }
+
+        free(c->lines);
+        free(c->path);
+        return mfree(c);
+}
+
+DEFINE_TRIVIAL_CLEANUP_FUNC(ConfigFileCache*, config_file_cache_free);
+
+void config_parse_cache_flush(void) {
+        ConfigFileCache *c;
+
+        while ((c = hashmap_steal_first(config_file_cache)))
+                config_file_cache_free(c);
+
+        config_file_cache = hashmap_free(config_file_cache);
+}
+
+static int config_file_cache_add_line(
+                ConfigFileCache *c,
+                const char *section,
+                unsigned section_line,
+                const char *lvalue,
+                const char *rvalue,
+                unsigned line) {
+
+        _cleanup_free_ char *s = NULL, *l = NULL, *r = NULL;
+        ConfigCacheLine *cl;
+
+        assert(c);
+        assert(lvalue);
+        assert(rvalue);
+
+        if (section) {
+                s = strdup(section);
+                if (!s)
+                        return -ENOMEM;
+        }
+
+        l = strdup(lvalue);
+        if (!l)
+                return -ENOMEM;
+
+        r = strdup(rvalue);
+        if (!r)
+                return -ENOMEM;
+
+        if (!GREEDY_REALLOC(c->lines, c->n_allocated, c->n_lines + 1))
+                return -ENOMEM;
+
+        cl = c->lines + c->n_lines++;
+        *cl = (ConfigCacheLine) {
+                .section = TAKE_PTR(s),
+                .lvalue = TAKE_PTR(l),
+                .rvalue = TAKE_PTR(r),
+                .line = line,
+                .section_line = section_line,
+        };
+
+        return 0;
+}
+
 int config_item_table_lookup(
                 const void *table,
                 const char *section,
@@ -159,9 +258,11 @@ static int parse_line(
                 unsigned *section_line,
                 bool *section_ignored,
                 char *l,
+                ConfigFileCache *cache,
                 void *userdata) {
 
-        char *e;
+        char *e, *lvalue, *rvalue;
+        int r;
 
         assert(filename);
         assert(line > 0);
@@ -239,6 +340,15 @@ static int parse_line(
         *e = 0;
         e++;
 
+        lvalue = strstrip(l);
+        rvalue = strstrip(e);
+
+        if (cache) {
+                r = config_file_cache_add_line(cache, *section, *section_line, lvalue, rvalue, line);
+                if (r < 0)
+                        return log_oom();
+        }
+
         return next_assignment(unit,
                                filename,
                                line,
@@ -246,8 +356,8 @@ static int parse_line(
                                table,
                                *section,
                                *section_line,
-                               strstrip(l),
-                               strstrip(e),
+                               lvalue,
+                               rvalue,
                                flags,
                                userdata);
 }
@@ -264,12 +374,14 @@ int config_parse(
                 void *userdata,
                 usec_t *ret_mtime) {
 
+        _cleanup_(config_file_cache_freep) ConfigFileCache *new_cache = NULL;
         _cleanup_free_ char *section = NULL, *continuation = NULL;
         _cleanup_fclose_ FILE *ours = NULL;
         unsigned line = 0, section_line = 0;
-        bool section_ignored = false, bom_seen = false;
+        bool section_ignored = false, bom_seen = false, have_stat = false;
+        uint64_t size = 0, inode = 0;
         int r, fd;
-        usec_t mtime;
+        usec_t mtime = 0;
 
         assert(filename);
         assert(lookup);
@@ -296,6 +408,61 @@ int config_parse(
 
                 (void) stat_warn_permissions(filename, &st);
                 mtime = timespec_load(&st.st_mtim);
+                size = (uint64_t) st.st_size;
+                inode = (uint64_t) st.st_ino;
+                have_stat = true;
+        }
+
+        if (FLAGS_SET(flags, CONFIG_PARSE_CACHE) && have_stat) {
+                ConfigFileCache *c;
+
+                c = hashmap_get(config_file_cache, filename);
+                if (c && c->mtime == mtime && c->size == size && c->inode == inode) {
+                        /* The file didn't change since we tokenized it last, hence replay the recorded
+                         * assignments instead of parsing it again. */
+
+                        for (size_t i = 0; i < c->n_lines; i++) {
+                                ConfigCacheLine *cl = c->lines + i;
+
+                                r = next_assignment(unit,
+                                                    filename,
+                                                    cl->line,
+                                                    lookup,
+                                                    table,
+                                                    cl->section,
+                                                    cl->section_line,
+                                                    cl->lvalue,
+                                                    cl->rvalue,
+                                                    flags,
+                                                    userdata);
+                                if (r < 0) {
+                                        if (flags & CONFIG_PARSE_WARN)
+                                                log_warning_errno(r, "%s:%u: Failed to parse file: %m", filename, cl->line);
+                                        return r;
+                                }
+                        }
+
+                        if (ret_mtime)
+                                *ret_mtime = mtime;
+
+                        return 0;
+                }
+
+                /* Cache entry missing or stale, record a fresh tokenization while we parse. This is
+                 * best-effort, if we can't allocate the cache we simply parse without recording. */
+                if (hashmap_size(config_file_cache) < CONFIG_FILE_CACHE_MAX) {
+                        new_cache = new0(ConfigFileCache, 1);
+                        if (new_cache) {
+                                new_cache->path = strdup(filename);
+                                if (!new_cache->path)
+                                        new_cache = config_file_cache_free(new_cache);
+                                else {
+                                        new_cache->mtime = mtime;
+                                        new_cache->size = size;
+                                        new_cache->inode = inode;
+                                }
+                        }
+                }
         }
 
         for (;;) {
@@ -386,6 +553,7 @@ int config_parse(
                                &section_line,
                                &section_ignored,
                                p,
+                               new_cache,
                                userdata);
                 if (r < 0) {
                         if (flags & CONFIG_PARSE_WARN)
@@ -408,6 +576,7 @@ int config_parse(
                                &section_line,
                                &section_ignored,
                                continuation,
+                               new_cache,
                                userdata);
                 if (r < 0) {
                         if (flags & CONFIG_PARSE_WARN)
@@ -416,6 +585,19 @@ int config_parse(
                 }
         }
 
+        if (new_cache) {
+                ConfigFileCache *old;
+
+                r = hashmap_ensure_allocated(&config_file_cache, &path_hash_ops);
+                if (r >= 0) {
+                        old = hashmap_remove(config_file_cache, new_cache->path);
+                        config_file_cache_free(old);
+
+                        if (hashmap_put(config_file_cache, new_cache->path, new_cache) >= 0)
+                                TAKE_PTR(new_cache); /* Now owned by the cache */
+                }
+        }
+
         if (ret_mtime)
                 *ret_mtime = mtime;
 
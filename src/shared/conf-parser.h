@@ -17,6 +17,7 @@
 typedef enum ConfigParseFlags {
         CONFIG_PARSE_RELAXED       = 1 << 0, /* Do not warn about unknown non-extension fields */
         CONFIG_PARSE_WARN          = 1 << 1, /* Emit non-debug messages */
+        CONFIG_PARSE_CACHE         = 1 << 2, /* Cache the tokenized file, and replay it if the file didn't change since the last parse */
 } ConfigParseFlags;
 
 /* Argument list for parsers of specific configuration settings. */
@@ -112,6 +113,8 @@ int config_parse_many(
                 void *userdata,
                 usec_t *ret_mtime);         /* possibly NULL */
 
+void config_parse_cache_flush(void);
+
 CONFIG_PARSER_PROTOTYPE(config_parse_int);
 CONFIG_PARSER_PROTOTYPE(config_parse_unsigned);
 CONFIG_PARSER_PROTOTYPE(config_parse_long);
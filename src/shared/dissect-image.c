@@ -972,7 +972,15 @@ int dissect_image(
                                 if (m->partitions[designator].found)
                                         continue;
 
-                                if (fstype) {
+                                if (!fstype && !FLAGS_SET(flags, DISSECT_IMAGE_NO_UDEV))
+                                        /* The partition type doesn't imply a file system type. But udev has
+                                         * probed the partition already when it processed its uevent (we
+                                         * waited for that above), hence reuse its result from the udev
+                                         * database rather than re-probing the device with libblkid in the
+                                         * fill-in pass at the bottom of this function. */
+                                        (void) sd_device_get_property_value(q, "ID_FS_TYPE", &fstype);
+
+                                if (!isempty(fstype)) {
                                         t = strdup(fstype);
                                         if (!t)
                                                 return -ENOMEM;
@@ -1367,6 +1375,13 @@ int dissected_image_mount(DissectedImage *m, const char *where, uid_t uid_shift,
         assert(m);
         assert(where);
 
+        /* Each caller mounts its own dissection of the image. Sharing is only done one level down, and only
+         * where it is safe: verity volumes are activated under a device name derived from the root hash and
+         * reused if already active (see verity_partition()), so concurrent starts from one signed image
+         * share the dm device and the page cache behind it. The block/mount layer on top is deliberately
+         * per-consumer — writable images must not share a file system instance, and a PID 1 registry
+         * ref-counting mounts across units would tie every user's lifetime to the slowest one. */
+
         /* Returns:
          *
          *  -ENXIO        → No root partition found
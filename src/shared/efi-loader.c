@@ -584,14 +584,35 @@ int efi_loader_get_boot_usec(usec_t *firmware, usec_t *loader) {
 }
 
 int efi_loader_get_device_part_uuid(sd_id128_t *u) {
+        static sd_id128_t cached_uuid;
+        static int cached_result;
+        static bool have_cache = false;
         _cleanup_free_ char *p = NULL;
+        unsigned i;
         int r, parsed[16];
 
         if (!is_efi_boot())
                 return -EOPNOTSUPP;
 
+        /* The boot loader sets this variable before handing control to the OS and it never changes while
+         * the system is up, hence cache the result — including its absence: efivarfs reads take
+         * milliseconds on some firmware, and the gpt-auto generator queries this more than once per run. */
+        if (have_cache) {
+                if (cached_result < 0)
+                        return cached_result;
+
+                if (u)
+                        *u = cached_uuid;
+                return 0;
+        }
+
         r = efi_get_variable_string(EFI_VENDOR_LOADER, "LoaderDevicePartUUID", &p);
-        if (r < 0)
+        if (r == -ENOENT) {
+                cached_result = r;
+                have_cache = true;
+                return r;
+        }
+        if (r < 0) /* Don't cache transient failures such as -EBUSY from efivarfs read rate-limiting */
                 return r;
 
         if (sscanf(p, SD_ID128_UUID_FORMAT_STR,
@@ -601,12 +622,14 @@ int efi_loader_get_device_part_uuid(sd_id128_t *u) {
                    &parsed[12], &parsed[13], &parsed[14], &parsed[15]) != 16)
                 return -EIO;
 
-        if (u) {
-                unsigned i;
+        for (i = 0; i < ELEMENTSOF(parsed); i++)
+                cached_uuid.bytes[i] = parsed[i];
 
-                for (i = 0; i < ELEMENTSOF(parsed); i++)
-                        u->bytes[i] = parsed[i];
-        }
+        cached_result = 0;
+        have_cache = true;
+
+        if (u)
+                *u = cached_uuid;
 
         return 0;
 }
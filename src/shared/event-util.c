@@ -0,0 +1,156 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "alloc-util.h"
+#include "async.h"
+#include "event-util.h"
+#include "fd-util.h"
+#include "macro.h"
+
+/* The result of the worker function is returned in the eventfd counter value, shifted by this base so that
+ * the written value is never zero and — more importantly — so that the worker thread doesn't need to touch
+ * any memory shared with the event loop once it signalled completion. The thread owns a dup of the eventfd,
+ * hence both sides may be torn down in any order. */
+#define THREADED_RESULT_BASE UINT64_C(0x100000000)
+
+typedef struct ThreadedWork {
+        int fd;
+        int (*work)(void *arg);
+        void *arg;
+} ThreadedWork;
+
+typedef struct ThreadedCompletion {
+        event_threaded_handler_t done;
+        void *userdata;
+} ThreadedCompletion;
+
+static void* threaded_work_thread(void *p) {
+        ThreadedWork *w = p;
+        _cleanup_close_ int fd = w->fd;
+        uint64_t v;
+        int r;
+
+        (void) pthread_setname_np(pthread_self(), "sd-worker");
+
+        r = w->work(w->arg);
+        free(w);
+
+        v = THREADED_RESULT_BASE + (uint32_t) r;
+        assert_se(write(fd, &v, sizeof(v)) == sizeof(v));
+
+        return NULL;
+}
+
+static int threaded_completion_handler(sd_event_source *s, int fd, uint32_t revents, void *userdata) {
+        ThreadedCompletion *c = userdata;
+        uint64_t v;
+        ssize_t n;
+
+        assert(c);
+
+        n = read(fd, &v, sizeof(v));
+        if (n < 0)
+                return -errno;
+        if (n != sizeof(v) || v < THREADED_RESULT_BASE)
+                return -EIO;
+
+        if (c->done)
+                return c->done(s, (int) (uint32_t) (v - THREADED_RESULT_BASE), c->userdata);
+
+        return 0;
+}
+
+int event_add_threaded(
+                sd_event *e,
+                sd_event_source **ret,
+                int (*work)(void *arg),
+                void *arg,
+                event_threaded_handler_t done,
+                void *userdata) {
+
+        _cleanup_(sd_event_source_unrefp) sd_event_source *s = NULL;
+        _cleanup_close_ int loop_fd = -1, thread_fd = -1;
+        _cleanup_free_ ThreadedCompletion *c = NULL;
+        ThreadedWork *w;
+        int r;
+
+        assert(e);
+        assert(work);
+
+        /* Runs the blocking work() function on a detached worker thread, and invokes done() with its return
+         * value from the event loop once it finished, so that event loop based daemons can issue blocking
+         * operations (fsync() and friends) without stalling their loop, and without inventing their own
+         * thread management. One thread is spawned per submitted job; if submission rates ever warrant it, a
+         * pool can be put behind this interface without changing callers. */
+
+        loop_fd = eventfd(0, EFD_CLOEXEC|EFD_NONBLOCK);
+        if (loop_fd < 0)
+                return -errno;
+
+        thread_fd = fcntl(loop_fd, F_DUPFD_CLOEXEC, 3);
+        if (thread_fd < 0)
+                return -errno;
+
+        c = new(ThreadedCompletion, 1);
+        if (!c)
+                return -ENOMEM;
+
+        *c = (ThreadedCompletion) {
+                .done = done,
+                .userdata = userdata,
+        };
+
+        r = sd_event_add_io(e, &s, loop_fd, EPOLLIN, threaded_completion_handler, c);
+        if (r < 0)
+                return r;
+
+        r = sd_event_source_set_io_fd_own(s, true);
+        if (r < 0)
+                return r;
+        TAKE_FD(loop_fd);
+
+        r = sd_event_source_set_enabled(s, SD_EVENT_ONESHOT);
+        if (r < 0)
+                return r;
+
+        /* Let the event source own the completion context */
+        r = sd_event_source_set_destroy_callback(s, free);
+        if (r < 0)
+                return r;
+        TAKE_PTR(c);
+
+        if (!ret) {
+                r = sd_event_source_set_floating(s, true);
+                if (r < 0)
+                        return r;
+        }
+
+        w = new(ThreadedWork, 1);
+        if (!w)
+                return -ENOMEM;
+
+        *w = (ThreadedWork) {
+                .fd = thread_fd,
+                .work = work,
+                .arg = arg,
+        };
+
+        /* Start the thread only now that nothing can fail anymore, so that submitted work is never lost */
+        r = asynchronous_job(threaded_work_thread, w);
+        if (r < 0) {
+                free(w);
+                return r;
+        }
+        TAKE_FD(thread_fd);
+
+        if (ret)
+                *ret = TAKE_PTR(s);
+        else
+                TAKE_PTR(s);
+
+        return 0;
+}
@@ -0,0 +1,14 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+#pragma once
+
+#include "sd-event.h"
+
+typedef int (*event_threaded_handler_t)(sd_event_source *s, int result, void *userdata);
+
+int event_add_threaded(
+                sd_event *e,
+                sd_event_source **ret,
+                int (*work)(void *arg),
+                void *arg,
+                event_threaded_handler_t done,
+                void *userdata);
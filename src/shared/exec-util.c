@@ -84,7 +84,10 @@ static int do_execute(
                 ExecDirFlags flags) {
 
         _cleanup_hashmap_free_free_ Hashmap *pids = NULL;
-        _cleanup_strv_free_ char **paths = NULL;
+        _cleanup_strv_free_ char **paths = NULL, **gather_names = NULL;
+        _cleanup_free_ int *gather_fds = NULL;
+        _cleanup_free_ pid_t *gather_pids = NULL;
+        size_t n_gather = 0;
         char **path, **e;
         int r;
         bool parallel_execution;
@@ -92,19 +95,30 @@ static int do_execute(
         /* We fork this all off from a child process so that we can somewhat cleanly make
          * use of SIGALRM to set a time limit.
          *
-         * We attempt to perform parallel execution if configured by the user, however
-         * if `callbacks` is nonnull, execution must be serial.
+         * If `callbacks` is nonnull, each executable's output must be consumed in the
+         * deterministic file name order, but that only constrains the gather phase: we
+         * can still run the executables concurrently, each with its own serialization
+         * fd, and process the outputs in order once everything exited.
          */
-        parallel_execution = FLAGS_SET(flags, EXEC_DIR_PARALLEL) && !callbacks;
+        parallel_execution = FLAGS_SET(flags, EXEC_DIR_PARALLEL);
 
         r = conf_files_list_strv(&paths, NULL, NULL, CONF_FILES_EXECUTABLE|CONF_FILES_REGULAR|CONF_FILES_FILTER_MASKED, (const char* const*) directories);
         if (r < 0)
                 return log_error_errno(r, "Failed to enumerate executables: %m");
 
         if (parallel_execution) {
-                pids = hashmap_new(NULL);
-                if (!pids)
-                        return log_oom();
+                if (callbacks) {
+                        size_t n = strv_length(paths);
+
+                        gather_fds = new(int, n);
+                        gather_pids = new(pid_t, n);
+                        if (!gather_fds || !gather_pids)
+                                return log_oom();
+                } else {
+                        pids = hashmap_new(NULL);
+                        if (!pids)
+                                return log_oom();
+                }
         }
 
         /* Abort execution of this process after the timeout. We simply rely on SIGALRM as
@@ -136,7 +150,15 @@ static int do_execute(
                 if (r <= 0)
                         continue;
 
-                if (parallel_execution) {
+                if (parallel_execution && callbacks) {
+                        r = strv_consume(&gather_names, TAKE_PTR(t));
+                        if (r < 0)
+                                return log_oom();
+
+                        gather_fds[n_gather] = TAKE_FD(fd);
+                        gather_pids[n_gather] = pid;
+                        n_gather++;
+                } else if (parallel_execution) {
                         r = hashmap_put(pids, PID_TO_PTR(pid), t);
                         if (r < 0)
                                 return log_oom();
@@ -161,6 +183,44 @@ static int do_execute(
                 }
         }
 
+        /* Consume the outputs of concurrently spawned executables strictly in file name order, so that
+         * parallel execution cannot change the merge result. */
+        if (n_gather > 0) {
+                int ret = 0;
+                size_t i;
+
+                for (i = 0; i < n_gather; i++) {
+                        r = wait_for_terminate_and_check(gather_names[i], gather_pids[i], WAIT_LOG);
+                        if (FLAGS_SET(flags, EXEC_DIR_IGNORE_ERRORS)) {
+                                if (r < 0)
+                                        continue;
+                        } else if (r > 0) {
+                                if (ret == 0)
+                                        ret = r;
+                                continue;
+                        }
+
+                        if (ret != 0) /* Already failed? Then only reap the remaining children. */
+                                continue;
+
+                        if (lseek(gather_fds[i], 0, SEEK_SET) < 0) {
+                                ret = log_error_errno(errno, "Failed to seek on serialization fd: %m");
+                                continue;
+                        }
+
+                        r = callbacks[STDOUT_GENERATE](gather_fds[i], callback_args[STDOUT_GENERATE]);
+                        gather_fds[i] = -1; /* The callback always consumes the fd */
+                        if (r < 0)
+                                ret = log_error_errno(r, "Failed to process output from %s: %m", gather_names[i]);
+                }
+
+                for (i = 0; i < n_gather; i++)
+                        safe_close(gather_fds[i]);
+
+                if (ret != 0)
+                        return ret;
+        }
+
         if (callbacks) {
                 r = callbacks[STDOUT_COLLECT](output_fd, callback_args[STDOUT_COLLECT]);
                 if (r < 0)
@@ -119,7 +119,14 @@ int fdset_new_fill(FDSet **_s) {
         assert(_s);
 
         /* Creates an fdset and fills in all currently open file
-         * descriptors. */
+         * descriptors.
+         *
+         * Note that fds collected this way are never copied anywhere during reexec: the
+         * serialization records their numbers and fdset_cloexec() clears O_CLOEXEC, so they simply
+         * survive the exec() and the new manager re-adopts them in place — the cost is flat in the
+         * number of fds held, not a per-fd message exchange. SCM_RIGHTS only enters the picture when
+         * a service pushes fds into the fd store via sd_pid_notify_with_fds(), and there all fds of
+         * a submission travel in a single control message. */
 
         d = opendir("/proc/self/fd");
         if (!d)
@@ -1815,6 +1815,12 @@ static const char* table_data_rgap_color(TableData *d) {
         return NULL;
 }
 
+/* Rendering is two-pass by design: widths are computed over all rows before anything is printed, because a
+ * layout fixed from the first N rows misaligns as soon as row N+1 holds a longer unit name — and sorting,
+ * which most callers use, needs the full row set anyway. Memory stays proportional to distinct cell values,
+ * not cells: identical TableData is shared via ref-counting (see table_dup_cell()/table_dedup_cell()),
+ * which is what keeps the repeated LOAD/ACTIVE/SUB strings of a big list-units cheap. Callers that truly
+ * want streaming output should emit rows themselves rather than teach the table to guess. */
 int table_print(Table *t, FILE *f) {
         size_t n_rows, *minimum_width, *maximum_width, display_columns, *requested_width,
                 table_minimum_width, table_maximum_width, table_requested_width, table_effective_width,
@@ -172,7 +172,12 @@ DEFINE_TRIVIAL_CLEANUP_FUNC(JsonSource*, json_source_unref);
  *    otherwise #4. This makes use of the fact that malloc() will return "maximum aligned" memory, which definitely
  *    means the pointer is even. This means we can use the uneven pointers to reference static strings, as long as we
  *    make sure that all static strings used like this are aligned to 2 (or higher), and that we mask the bit on
- *    access. The JSON_VARIANT_STRING_CONST() macro encodes strings as JsonVariant* pointers, with the bit set. */
+ *    access. The JSON_VARIANT_STRING_CONST() macro encodes strings as JsonVariant* pointers, with the bit set.
+ *
+ * Note that the element variants of an array/object live in the same allocation as the array/object itself (see
+ * json_variant_new_array() and the 'is_embedded' flag): a whole document parses into one allocation per container
+ * plus one per oversized string, with only the outermost variant reference counted, and is freed in one go with the
+ * last reference. */
 
 static bool json_variant_is_magic(const JsonVariant *v) {
         if (!v)
@@ -2411,8 +2416,24 @@ static int json_parse_string(const char **p, char **ret) {
         c++;
 
         for (;;) {
+                size_t run;
                 int len;
 
+                /* Copy runs of plain ASCII in bulk, rather than through the per-character logic below.
+                 * Escapes, the closing quote, control characters and multi-byte sequences terminate the
+                 * run and are handled one at a time as before. */
+                run = 0;
+                while (c[run] >= 0x20 && c[run] < 0x7f && !IN_SET(c[run], '"', '\\'))
+                        run++;
+                if (run > 0) {
+                        if (!GREEDY_REALLOC(s, allocated, n + run + 1))
+                                return -ENOMEM;
+
+                        memcpy(s + n, c, run);
+                        n += run;
+                        c += run;
+                }
+
                 /* Check for EOF */
                 if (*c == 0)
                         return -EINVAL;
@@ -992,6 +992,13 @@ static int update_json_data_split(
         return update_json_data(h, flags, name, eq + 1, size - fieldlen - 1);
 }
 
+/* Serves all four JSON modes (json, json-pretty, json-sse and RFC 7464 json-seq) through one
+ * JsonVariant tree per entry. That's slower than a hand-rolled escape-as-you-copy emitter, but the
+ * tree buys correctness that is easy to get wrong by hand: repeated fields become arrays, binary
+ * and non-UTF-8 values become byte arrays, threshold-truncated data becomes null — all decided
+ * after the whole entry is collected, which a streaming emitter can't do without buffering anyway.
+ * Bulk exports that want to saturate the disk should use -o export, which is a verbatim copy of
+ * the entry data and is the interchange format meant for that job. */
 static int output_json(
                 FILE *f,
                 sd_journal *j,
@@ -1640,6 +1647,14 @@ int show_journal_by_unit(
         if (how_many <= 0)
                 return 0;
 
+        /* The tail query below is already index-backed: every match (_SYSTEMD_UNIT= and friends) resolves
+         * to a data object whose entry array lets us step to its last entries directly, without scanning
+         * unrelated records. What scales the cost up on busy hosts is the number of journal files that have
+         * to be consulted and interleaved — many rotated archives, per-user splits — not journal size as
+         * such. A journald-maintained per-unit cursor sidecar would merely duplicate the entry arrays and
+         * could go stale against vacuuming; keeping files larger and fewer (SystemMaxFileSize=) is the
+         * effective lever. */
+
         r = sd_journal_open_namespace(&j, log_namespace, journal_open_flags | SD_JOURNAL_INCLUDE_DEFAULT_NAMESPACE);
         if (r < 0)
                 return log_error_errno(r, "Failed to open journal: %m");
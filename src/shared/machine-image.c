@@ -536,6 +536,18 @@ int image_discover(ImageClass class, Hashmap *h) {
                         if (dot_or_dot_dot(de->d_name))
                                 continue;
 
+                        /* ".#…" temporary files created for atomic replacement never make valid image names,
+                         * no matter how the name is derived below, hence don't bother stat()ing them */
+                        if (startswith(de->d_name, ".#"))
+                                continue;
+
+                        /* Where the file type is already known from the directory entry we can skip entries
+                         * that can't possibly be (or link to) an image without issuing a stat() for them */
+                        if (!IN_SET(de->d_type, DT_UNKNOWN, DT_LNK, DT_REG, DT_DIR, DT_BLK))
+                                continue;
+                        if (de->d_type == DT_REG && !endswith(de->d_name, ".raw"))
+                                continue;
+
                         /* As mentioned above, we follow symlinks on this fstatat(), because we want to permit people
                          * to symlink block devices into the search path */
                         if (fstatat(dirfd(d), de->d_name, &st, 0) < 0) {
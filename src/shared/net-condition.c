@@ -139,33 +139,21 @@ bool net_match_config(
                 sd_device *device,
                 const struct ether_addr *mac,
                 const struct ether_addr *permanent_mac,
+                const char *path,
                 const char *driver,
-                unsigned short iftype,
+                const char *iftype_str,
                 const char *ifname,
                 char * const *alternative_names,
                 enum nl80211_iftype wifi_iftype,
                 const char *ssid,
                 const struct ether_addr *bssid) {
 
-        _cleanup_free_ char *iftype_str;
-        const char *path = NULL;
-
         assert(match);
 
-        iftype_str = link_get_type_string(device, iftype);
-
-        if (device) {
-                const char *mac_str;
-
-                (void) sd_device_get_property_value(device, "ID_PATH", &path);
-                if (!driver)
-                        (void) sd_device_get_property_value(device, "ID_NET_DRIVER", &driver);
-                if (!ifname)
-                        (void) sd_device_get_sysname(device, &ifname);
-                if (!mac &&
-                    sd_device_get_sysattr_value(device, "address", &mac_str) >= 0)
-                        mac = ether_aton(mac_str);
-        }
+        /* Note that callers are expected to resolve the device specific attributes (path, driver, type
+         * string, MAC address) once, and not leave that to us: this function typically runs in a loop over
+         * many match expressions for the same device, and re-deriving them for each would dominate the
+         * matching cost. */
 
         if (match->mac && (!mac || !set_contains(match->mac, mac)))
                 return false;
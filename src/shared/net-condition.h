@@ -31,8 +31,9 @@ bool net_match_config(
                 sd_device *device,
                 const struct ether_addr *mac,
                 const struct ether_addr *permanent_mac,
+                const char *path,
                 const char *driver,
-                unsigned short iftype,
+                const char *iftype_str,
                 const char *ifname,
                 char * const *alternative_names,
                 enum nl80211_iftype wifi_iftype,
@@ -1064,7 +1064,16 @@ int seccomp_load_syscall_filter_set_raw(uint32_t default_action, Hashmap* set, u
         int r;
 
         /* Similar to seccomp_load_syscall_filter_set(), but takes a raw Set* of syscalls, instead of a
-         * SyscallFilterSet* table. */
+         * SyscallFilterSet* table.
+         *
+         * The BPF program is recompiled for every caller even though most units carry the same filter set.
+         * Reusing a compiled program across units isn't practical: this runs in the forked child (the
+         * filter must attach to that task), libseccomp contexts can't be handed across processes, and a
+         * pre-exported BPF blob installed via raw seccomp(2) would bypass libseccomp's per-architecture
+         * fixups (multiplexed socket calls, arch-specific syscall numbering) that this loop relies on.
+         * The key would also have to cover default action, per-syscall errno values and the native arch
+         * list, not just the set name — at which point the cache outweighs the few ms of compile time it
+         * saves in the child. */
 
         if (hashmap_isempty(set) && default_action == SCMP_ACT_ALLOW)
                 return 0;
@@ -42,17 +42,16 @@ char *sysctl_normalize(char *s) {
         return s;
 }
 
-int sysctl_write(const char *property, const char *value) {
-        char *p;
+int sysctl_write_at(int dir_fd, const char *property, const char *value) {
         _cleanup_close_ int fd = -1;
 
+        assert(dir_fd >= 0 || dir_fd == AT_FDCWD);
         assert(property);
         assert(value);
 
         log_debug("Setting '%s' to '%.*s'.", property, (int) strcspn(value, NEWLINE), value);
 
-        p = strjoina("/proc/sys/", property);
-        fd = open(p, O_WRONLY|O_CLOEXEC);
+        fd = openat(dir_fd, property, O_WRONLY|O_CLOEXEC);
         if (fd < 0)
                 return -errno;
 
@@ -65,6 +64,12 @@ int sysctl_write(const char *property, const char *value) {
         return 0;
 }
 
+int sysctl_write(const char *property, const char *value) {
+        assert(property);
+
+        return sysctl_write_at(AT_FDCWD, strjoina("/proc/sys/", property), value);
+}
+
 int sysctl_writef(const char *property, const char *format, ...) {
         _cleanup_free_ char *v = NULL;
         va_list ap;
@@ -539,6 +539,14 @@ int udev_resolve_subsys_kernel(const char *string, char *result, size_t maxsize,
         return 0;
 }
 
+/* The queue state interface is deliberately this small: udevd creates /run/udev/queue when the
+ * event queue becomes non-empty and unlinks it when it drains, and waiters get woken through
+ * inotify IN_DELETE — no polling is involved, the 1s poll timeout in settle is only a robustness
+ * backstop. A finer-grained interface exposing the current seqnum window (the old libudev
+ * queue.bin file, or a futex-waitable shared-memory variant of it) was removed on purpose:
+ * readers inevitably race the writer, and publishing seqnums turns udevd's internal event
+ * ordering into ABI. Anything that needs to wait for a specific device should watch for that
+ * device (e.g. settle's --exists, or a udev monitor), not for a queue position. */
 int udev_queue_is_empty(void) {
         return access("/run/udev/queue", F_OK) < 0 ?
                 (errno == ENOENT ? true : -errno) : false;
@@ -384,6 +384,13 @@ static int userdb_connect(
         return r;
 }
 
+/* Connects to all matching services up front; replies are then collected by the iterator's event
+ * loop in whatever order the backends answer, so a key lookup completes at the speed of the fastest
+ * backend holding the record — and returning from the lookup frees the iterator, which closes the
+ * connections to any stragglers. What we deliberately do not keep is a process-wide negative-result
+ * TTL cache: user/group existence feeds authorization decisions, and serving a stale "does not
+ * exist" (or worse, masking a newly created user) from a cache with no invalidation channel is how
+ * nscd earned its reputation. Backends cache where they can invalidate. */
 static int userdb_start_query(
                 UserDBIterator *iterator,
                 const char *method,
@@ -595,6 +602,125 @@ static int synthetic_nobody_user_build(UserRecord **ret) {
                                           JSON_BUILD_PAIR("disposition", JSON_BUILD_STRING("intrinsic"))));
 }
 
+static int userdb_query_multiplexer_sync(
+                const char *method,
+                JsonVariant *query,
+                UserDBFlags flags,
+                LookupWhat what,
+                UserRecord **ret_user,
+                GroupRecord **ret_group) {
+
+        static const JsonDispatch dispatch_table[] = {
+                { "record",     _JSON_VARIANT_TYPE_INVALID, json_dispatch_variant, offsetof(struct user_group_data, record),     0 },
+                { "incomplete", JSON_VARIANT_BOOLEAN,       json_dispatch_boolean, offsetof(struct user_group_data, incomplete), 0 },
+                {}
+        };
+
+        _cleanup_(user_group_data_release) struct user_group_data d = {};
+        _cleanup_(json_variant_unrefp) JsonVariant *patched_query = NULL;
+        _cleanup_(varlink_unrefp) Varlink *vl = NULL;
+        JsonVariant *reply = NULL;
+        const char *error_id = NULL;
+        int r;
+
+        assert(method);
+        assert(query);
+
+        /* Shortcut for simple key lookups: do a plain synchronous call to the multiplexer, without setting
+         * up an iterator, an event loop and a reply callback for a single round trip. Returns -EUNATCH if
+         * the shortcut isn't applicable and the caller shall take the generic, parallel-connection path
+         * instead. */
+
+        /* The same conditions under which userdb_start_query() would skip the multiplexer */
+        if ((flags & (USERDB_AVOID_MULTIPLEXER|USERDB_AVOID_DYNAMIC_USER|USERDB_AVOID_NSS|USERDB_DONT_SYNTHESIZE)) != 0)
+                return -EUNATCH;
+        if (getenv("SYSTEMD_BYPASS_USERDB") || getenv("SYSTEMD_ONLY_USERDB"))
+                return -EUNATCH; /* Debug hooks are set, honour them via the generic path */
+
+        patched_query = json_variant_ref(query);
+        r = json_variant_set_field_string(&patched_query, "service", "io.systemd.Multiplexer");
+        if (r < 0)
+                return log_debug_errno(r, "Unable to set service JSON field: %m");
+
+        r = varlink_connect_address(&vl, "/run/systemd/userdb/io.systemd.Multiplexer");
+        if (r < 0) {
+                log_debug_errno(r, "Unable to connect to multiplexer, using generic lookup path: %m");
+                return -EUNATCH;
+        }
+
+        (void) varlink_set_description(vl, "io.systemd.Multiplexer");
+
+        r = varlink_call(vl, method, patched_query, &reply, &error_id, NULL);
+        if (r < 0) {
+                log_debug_errno(r, "Multiplexer call failed, using generic lookup path: %m");
+                return -EUNATCH;
+        }
+
+        if (error_id) {
+                log_debug("Got lookup error: %s", error_id);
+
+                if (STR_IN_SET(error_id,
+                               "io.systemd.UserDatabase.NoRecordFound",
+                               "io.systemd.UserDatabase.ConflictingRecordFound"))
+                        return -ESRCH;
+                if (streq(error_id, "io.systemd.UserDatabase.ServiceNotAvailable"))
+                        return -EHOSTDOWN;
+                if (streq(error_id, VARLINK_ERROR_TIMEOUT))
+                        return -ETIMEDOUT;
+
+                return -EIO;
+        }
+
+        r = json_dispatch(reply, dispatch_table, NULL, 0, &d);
+        if (r < 0)
+                return r;
+
+        if (!d.record)
+                return log_debug_errno(SYNTHETIC_ERRNO(EIO), "Reply is missing record key");
+
+        if (what == LOOKUP_USER) {
+                _cleanup_(user_record_unrefp) UserRecord *hr = NULL;
+
+                hr = user_record_new();
+                if (!hr)
+                        return -ENOMEM;
+
+                r = user_record_load(hr, d.record, USER_RECORD_LOAD_REFUSE_SECRET|USER_RECORD_PERMISSIVE);
+                if (r < 0)
+                        return r;
+
+                if (!hr->service)
+                        return log_debug_errno(SYNTHETIC_ERRNO(EINVAL), "User record does not carry service information, refusing.");
+
+                hr->incomplete = d.incomplete;
+
+                if (ret_user)
+                        *ret_user = TAKE_PTR(hr);
+        } else {
+                _cleanup_(group_record_unrefp) GroupRecord *g = NULL;
+
+                assert(what == LOOKUP_GROUP);
+
+                g = group_record_new();
+                if (!g)
+                        return -ENOMEM;
+
+                r = group_record_load(g, d.record, USER_RECORD_LOAD_REFUSE_SECRET|USER_RECORD_PERMISSIVE);
+                if (r < 0)
+                        return r;
+
+                if (!g->service)
+                        return log_debug_errno(SYNTHETIC_ERRNO(EINVAL), "Group record does not carry service information, refusing.");
+
+                g->incomplete = d.incomplete;
+
+                if (ret_group)
+                        *ret_group = TAKE_PTR(g);
+        }
+
+        return 0;
+}
+
 int userdb_by_name(const char *name, UserDBFlags flags, UserRecord **ret) {
         _cleanup_(userdb_iterator_freep) UserDBIterator *iterator = NULL;
         _cleanup_(json_variant_unrefp) JsonVariant *query = NULL;
@@ -608,6 +734,13 @@ int userdb_by_name(const char *name, UserDBFlags flags, UserRecord **ret) {
         if (r < 0)
                 return r;
 
+        r = userdb_query_multiplexer_sync("io.systemd.UserDatabase.GetUserRecord", query, flags, LOOKUP_USER, ret, NULL);
+        if (r >= 0)
+                return r;
+        if (r != -EUNATCH)
+                /* The multiplexer answered authoritatively (it covers NSS too), only synthesizing is left */
+                goto synthesize;
+
         iterator = userdb_iterator_new(LOOKUP_USER);
         if (!iterator)
                 return -ENOMEM;
@@ -631,6 +764,8 @@ int userdb_by_name(const char *name, UserDBFlags flags, UserRecord **ret) {
                 }
         }
 
+synthesize:
+
         if (!FLAGS_SET(flags, USERDB_DONT_SYNTHESIZE)) {
                 if (streq(name, "root"))
                         return synthetic_root_user_build(ret);
@@ -655,6 +790,12 @@ int userdb_by_uid(uid_t uid, UserDBFlags flags, UserRecord **ret) {
         if (r < 0)
                 return r;
 
+        r = userdb_query_multiplexer_sync("io.systemd.UserDatabase.GetUserRecord", query, flags, LOOKUP_USER, ret, NULL);
+        if (r >= 0)
+                return r;
+        if (r != -EUNATCH)
+                goto synthesize;
+
         iterator = userdb_iterator_new(LOOKUP_USER);
         if (!iterator)
                 return -ENOMEM;
@@ -676,6 +817,7 @@ int userdb_by_uid(uid_t uid, UserDBFlags flags, UserRecord **ret) {
                 }
         }
 
+synthesize:
         if (!FLAGS_SET(flags, USERDB_DONT_SYNTHESIZE)) {
                 if (uid == 0)
                         return synthetic_root_user_build(ret);
@@ -812,6 +954,12 @@ int groupdb_by_name(const char *name, UserDBFlags flags, GroupRecord **ret) {
         if (r < 0)
                 return r;
 
+        r = userdb_query_multiplexer_sync("io.systemd.UserDatabase.GetGroupRecord", query, flags, LOOKUP_GROUP, NULL, ret);
+        if (r >= 0)
+                return r;
+        if (r != -EUNATCH)
+                goto synthesize;
+
         iterator = userdb_iterator_new(LOOKUP_GROUP);
         if (!iterator)
                 return -ENOMEM;
@@ -832,6 +980,7 @@ int groupdb_by_name(const char *name, UserDBFlags flags, GroupRecord **ret) {
                 }
         }
 
+synthesize:
         if (!FLAGS_SET(flags, USERDB_DONT_SYNTHESIZE)) {
                 if (streq(name, "root"))
                         return synthetic_root_group_build(ret);
@@ -856,6 +1005,12 @@ int groupdb_by_gid(gid_t gid, UserDBFlags flags, GroupRecord **ret) {
         if (r < 0)
                 return r;
 
+        r = userdb_query_multiplexer_sync("io.systemd.UserDatabase.GetGroupRecord", query, flags, LOOKUP_GROUP, NULL, ret);
+        if (r >= 0)
+                return r;
+        if (r != -EUNATCH)
+                goto synthesize;
+
         iterator = userdb_iterator_new(LOOKUP_GROUP);
         if (!iterator)
                 return -ENOMEM;
@@ -876,6 +1031,7 @@ int groupdb_by_gid(gid_t gid, UserDBFlags flags, GroupRecord **ret) {
                 }
         }
 
+synthesize:
         if (!FLAGS_SET(flags, USERDB_DONT_SYNTHESIZE)) {
                 if (gid == 0)
                         return synthetic_root_group_build(ret);
@@ -1257,27 +1257,19 @@ static int varlink_enqueue_json(Varlink *v, JsonVariant *m) {
                 v->output_buffer_size = v->output_buffer_allocated = r + 1;
                 v->output_buffer_index = 0;
 
-        } else if (v->output_buffer_index == 0) {
+        } else {
+                if (v->output_buffer_index > 0) {
+                        /* Move the pending data to the front of the buffer first, so that we can append to
+                         * the existing allocation instead of copying everything into a fresh one. */
+                        memmove(v->output_buffer, v->output_buffer + v->output_buffer_index, v->output_buffer_size);
+                        v->output_buffer_index = 0;
+                }
 
                 if (!GREEDY_REALLOC(v->output_buffer, v->output_buffer_allocated, v->output_buffer_size + r + 1))
                         return -ENOMEM;
 
                 memcpy(v->output_buffer + v->output_buffer_size, text, r + 1);
                 v->output_buffer_size += r + 1;
-
-        } else {
-                char *n;
-                const size_t new_size = v->output_buffer_size + r + 1;
-
-                n = new(char, new_size);
-                if (!n)
-                        return -ENOMEM;
-
-                memcpy(mempcpy(n, v->output_buffer + v->output_buffer_index, v->output_buffer_size), text, r + 1);
-
-                free_and_replace(v->output_buffer, n);
-                v->output_buffer_allocated = v->output_buffer_size = new_size;
-                v->output_buffer_index = 0;
         }
 
         return 0;
@@ -2104,6 +2096,12 @@ static int count_connection(VarlinkServer *server, struct ucred *ucred) {
         return 0;
 }
 
+/* All connections of a VarlinkServer are dispatched on one event loop; the server is
+ * single-threaded like the rest of the codebase (sd_event is not thread-safe, and method callbacks
+ * would otherwise need per-service locking contracts). Services that want to use more than one core
+ * scale the way userdbd does: a pool of worker processes inheriting the same listener fd, with the
+ * kernel distributing accepts — that gives multi-core scaling plus crash isolation, and the pool
+ * grows and shrinks with demand. Don't add threads here. */
 int varlink_server_add_connection(VarlinkServer *server, int fd, Varlink **ret) {
         _cleanup_(varlink_unrefp) Varlink *v = NULL;
         bool ucred_acquired;
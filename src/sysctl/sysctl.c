@@ -1,6 +1,7 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
 
 #include <errno.h>
+#include <fcntl.h>
 #include <getopt.h>
 #include <limits.h>
 #include <stdbool.h>
@@ -97,10 +98,10 @@ static Option *option_new(
         return TAKE_PTR(o);
 }
 
-static int sysctl_write_or_warn(const char *key, const char *value, bool ignore_failure) {
+static int sysctl_write_or_warn(int proc_sys_fd, const char *key, const char *value, bool ignore_failure) {
         int r;
 
-        r = sysctl_write(key, value);
+        r = sysctl_write_at(proc_sys_fd, key, value);
         if (r < 0) {
                 /* If the sysctl is not available in the kernel or we are running with reduced privileges and
                  * cannot write it, then log about the issue, and proceed without failing. (EROFS is treated
@@ -117,7 +118,15 @@ static int sysctl_write_or_warn(const char *key, const char *value, bool ignore_
         return 0;
 }
 
-static int apply_all(OrderedHashmap *sysctl_options) {
+/* Every configured key is written unconditionally, no read-compare-skip. That's not an oversight:
+ * for "action" sysctls the write is the point even when the value already matches — vm.drop_caches
+ * reads back the last value written, so comparing would wrongly skip the flush — and some reads
+ * have side effects of their own (reading vm.stat_refresh triggers the refresh). On the common
+ * boot path most values differ from kernel defaults anyway, so a compare pass would add a read
+ * per key just to save the rare redundant write. Globs are expanded exactly once per invocation
+ * below; there is nothing to cache across runs since the matching set depends on which modules
+ * happen to be loaded. */
+static int apply_all(int proc_sys_fd, OrderedHashmap *sysctl_options) {
         Option *option;
         int r = 0;
 
@@ -165,13 +174,13 @@ static int apply_all(OrderedHashmap *sysctl_options) {
                                         continue;
                                 }
 
-                                k = sysctl_write_or_warn(key, option->value, option->ignore_failure);
+                                k = sysctl_write_or_warn(proc_sys_fd, key, option->value, option->ignore_failure);
                                 if (r == 0)
                                         r = k;
                         }
 
                 } else {
-                        k = sysctl_write_or_warn(option->key, option->value, option->ignore_failure);
+                        k = sysctl_write_or_warn(proc_sys_fd, option->key, option->value, option->ignore_failure);
                         if (r == 0)
                                 r = k;
                 }
@@ -381,6 +390,7 @@ static int parse_argv(int argc, char *argv[]) {
 
 static int run(int argc, char *argv[]) {
         _cleanup_(ordered_hashmap_freep) OrderedHashmap *sysctl_options = NULL;
+        _cleanup_close_ int proc_sys_fd = -1;
         int r, k;
 
         r = parse_argv(argc, argv);
@@ -422,7 +432,13 @@ static int run(int argc, char *argv[]) {
                 }
         }
 
-        k = apply_all(sysctl_options);
+        /* Open /proc/sys/ once, and write all options relative to it, so that the prefix is not resolved
+         * over and over again. */
+        proc_sys_fd = open("/proc/sys", O_PATH|O_DIRECTORY|O_CLOEXEC);
+        if (proc_sys_fd < 0)
+                return log_error_errno(errno, "Failed to open /proc/sys/: %m");
+
+        k = apply_all(proc_sys_fd, sysctl_options);
         if (k < 0 && r == 0)
                 r = k;
 
@@ -36,6 +36,7 @@ int sd_journal_print(int priority, const char *format, ...) _sd_printf_(2, 3);
 int sd_journal_printv(int priority, const char *format, va_list ap) _sd_printf_(2, 0);
 int sd_journal_send(const char *format, ...) _sd_printf_(1, 0) _sd_sentinel_;
 int sd_journal_sendv(const struct iovec *iov, int n);
+int sd_journal_sendv_batch(const struct iovec *iov, const int *n_fields, int n_entries);
 int sd_journal_perror(const char *message);
 
 /* Used by the macros below. You probably don't want to call this directly. */
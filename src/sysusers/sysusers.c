@@ -80,6 +80,12 @@ static Hashmap *database_by_uid = NULL, *database_by_username = NULL;
 static Hashmap *database_by_gid = NULL, *database_by_groupname = NULL;
 static Set *database_users = NULL, *database_groups = NULL;
 
+/* Negative NSS probe results, i.e. ids that no NSS source knows. Each getpwuid()/getgrgid() probe makes the
+ * files NSS module reparse /etc/passwd resp. /etc/group from scratch, and we probe the same ids repeatedly
+ * through the various allocation fallbacks. NSS state doesn't change until we commit everything in
+ * write_files(), hence a once-negative answer stays negative for the rest of the run. */
+static Set *nss_free_uids = NULL, *nss_free_gids = NULL;
+
 static uid_t search_uid = UID_INVALID;
 static UidRange *uid_range = NULL;
 static unsigned n_uid_range = 0;
@@ -98,6 +104,8 @@ STATIC_DESTRUCTOR_REGISTER(database_users, set_free_freep);
 STATIC_DESTRUCTOR_REGISTER(database_by_gid, hashmap_freep);
 STATIC_DESTRUCTOR_REGISTER(database_by_groupname, hashmap_freep);
 STATIC_DESTRUCTOR_REGISTER(database_groups, set_free_freep);
+STATIC_DESTRUCTOR_REGISTER(nss_free_uids, set_freep);
+STATIC_DESTRUCTOR_REGISTER(nss_free_gids, set_freep);
 STATIC_DESTRUCTOR_REGISTER(uid_range, freep);
 STATIC_DESTRUCTOR_REGISTER(arg_root, freep);
 STATIC_DESTRUCTOR_REGISTER(arg_image, freep);
@@ -855,14 +863,19 @@ static int uid_is_ok(uid_t uid, const char *name, bool check_with_gid) {
 
         /* Let's also check via NSS, to avoid UID clashes over LDAP and such, just in case */
         if (!arg_root) {
-                errno = 0;
-                p = getpwuid(uid);
-                if (p)
-                        return 0;
-                if (!IN_SET(errno, 0, ENOENT))
-                        return -errno;
+                if (!set_contains(nss_free_uids, UID_TO_PTR(uid))) {
+                        errno = 0;
+                        p = getpwuid(uid);
+                        if (p)
+                                return 0;
+                        if (!IN_SET(errno, 0, ENOENT))
+                                return -errno;
 
-                if (check_with_gid) {
+                        if (set_ensure_put(&nss_free_uids, NULL, UID_TO_PTR(uid)) < 0)
+                                return -ENOMEM;
+                }
+
+                if (check_with_gid && !set_contains(nss_free_gids, GID_TO_PTR(uid))) {
                         errno = 0;
                         g = getgrgid((gid_t) uid);
                         if (g) {
@@ -870,6 +883,8 @@ static int uid_is_ok(uid_t uid, const char *name, bool check_with_gid) {
                                         return 0;
                         } else if (!IN_SET(errno, 0, ENOENT))
                                 return -errno;
+                        else if (set_ensure_put(&nss_free_gids, NULL, GID_TO_PTR(uid)) < 0)
+                                return -ENOMEM;
                 }
         }
 
@@ -1075,19 +1090,29 @@ static int gid_is_ok(gid_t gid) {
                 return 0;
 
         if (!arg_root) {
-                errno = 0;
-                g = getgrgid(gid);
-                if (g)
-                        return 0;
-                if (!IN_SET(errno, 0, ENOENT))
-                        return -errno;
+                if (!set_contains(nss_free_gids, GID_TO_PTR(gid))) {
+                        errno = 0;
+                        g = getgrgid(gid);
+                        if (g)
+                                return 0;
+                        if (!IN_SET(errno, 0, ENOENT))
+                                return -errno;
 
-                errno = 0;
-                p = getpwuid((uid_t) gid);
-                if (p)
-                        return 0;
-                if (!IN_SET(errno, 0, ENOENT))
-                        return -errno;
+                        if (set_ensure_put(&nss_free_gids, NULL, GID_TO_PTR(gid)) < 0)
+                                return -ENOMEM;
+                }
+
+                if (!set_contains(nss_free_uids, UID_TO_PTR(gid))) {
+                        errno = 0;
+                        p = getpwuid((uid_t) gid);
+                        if (p)
+                                return 0;
+                        if (!IN_SET(errno, 0, ENOENT))
+                                return -errno;
+
+                        if (set_ensure_put(&nss_free_uids, NULL, UID_TO_PTR(gid)) < 0)
+                                return -ENOMEM;
+                }
         }
 
         return 1;
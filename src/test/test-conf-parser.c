@@ -385,6 +385,48 @@ static void test_config_parse(unsigned i, const char *s) {
         }
 }
 
+static void test_config_parse_cache(void) {
+        _cleanup_(unlink_tempfilep) char name[] = "/tmp/test-conf-parser.XXXXXX";
+        _cleanup_fclose_ FILE *f = NULL;
+        _cleanup_free_ char *setting1 = NULL;
+        usec_t mtime1 = 0, mtime2 = 0;
+
+        const ConfigTableItem items[] = {
+                { "Section", "setting1", config_parse_string, 0, &setting1},
+                {}
+        };
+
+        log_info("== %s ==", __func__);
+
+        assert_se(fmkostemp_safe(name, "r+", &f) == 0);
+        assert_se(fputs("[Section]\n"
+                        "setting1=first\n", f) >= 0);
+        assert_se(fflush(f) == 0);
+        rewind(f);
+
+        assert_se(config_parse(NULL, name, f,
+                               "Section\0",
+                               config_item_table_lookup, items,
+                               CONFIG_PARSE_WARN|CONFIG_PARSE_CACHE,
+                               NULL,
+                               &mtime1) == 0);
+        assert_se(streq_ptr(setting1, "first"));
+
+        /* A second run over the unchanged file must replay the cached tokenization with identical results. */
+        rewind(f);
+        setting1 = mfree(setting1);
+        assert_se(config_parse(NULL, name, f,
+                               "Section\0",
+                               config_item_table_lookup, items,
+                               CONFIG_PARSE_WARN|CONFIG_PARSE_CACHE,
+                               NULL,
+                               &mtime2) == 0);
+        assert_se(streq_ptr(setting1, "first"));
+        assert_se(mtime1 == mtime2);
+
+        config_parse_cache_flush();
+}
+
 int main(int argc, char **argv) {
         unsigned i;
 
@@ -403,6 +445,7 @@ int main(int argc, char **argv) {
         test_config_parse_sec();
         test_config_parse_nsec();
         test_config_parse_iec_uint64();
+        test_config_parse_cache();
 
         for (i = 0; i < ELEMENTSOF(config_file); i++)
                 test_config_parse(i, config_file[i]);
@@ -0,0 +1,61 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#include <errno.h>
+#include <unistd.h>
+
+#include "sd-event.h"
+
+#include "event-util.h"
+#include "macro.h"
+#include "time-util.h"
+
+static bool done_called = false;
+
+static int work(void *arg) {
+        return PTR_TO_INT(arg);
+}
+
+static int done(sd_event_source *s, int result, void *userdata) {
+        assert_se(result == PTR_TO_INT(userdata));
+        done_called = true;
+
+        return sd_event_exit(sd_event_source_get_event(s), 0);
+}
+
+static void test_event_add_threaded(int result) {
+        _cleanup_(sd_event_unrefp) sd_event *e = NULL;
+
+        assert_se(sd_event_new(&e) >= 0);
+
+        /* Passing NULL for ret exercises the floating source path; the result round-trips through the
+         * eventfd counter, including negative errno-style values. */
+        done_called = false;
+        assert_se(event_add_threaded(e, NULL, work, INT_TO_PTR(result), done, INT_TO_PTR(result)) >= 0);
+        assert_se(sd_event_loop(e) == 0);
+        assert_se(done_called);
+}
+
+static void test_event_add_threaded_cancel(void) {
+        _cleanup_(sd_event_unrefp) sd_event *e = NULL;
+        sd_event_source *s = NULL;
+
+        assert_se(sd_event_new(&e) >= 0);
+
+        done_called = false;
+        assert_se(event_add_threaded(e, &s, work, INT_TO_PTR(0), done, INT_TO_PTR(0)) >= 0);
+
+        /* Dropping the source means the completion is never delivered, and the worker signalling into its
+         * own dup of the eventfd after the loop side is gone must be harmless. */
+        s = sd_event_source_unref(s);
+
+        assert_se(sd_event_run(e, 200 * USEC_PER_MSEC) >= 0);
+        assert_se(!done_called);
+}
+
+int main(int argc, char *argv[]) {
+        test_event_add_threaded(7);
+        test_event_add_threaded(-ENOENT);
+        test_event_add_threaded_cancel();
+
+        return 0;
+}
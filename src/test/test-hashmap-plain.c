@@ -265,6 +265,21 @@ static void test_hashmap_put(void) {
         hashmap_free(m);
 }
 
+static void test_hashmap_ensure_put(void) {
+        _cleanup_hashmap_free_ Hashmap *m = NULL;
+        void *val1 = (void*) "val 1";
+        void *val2 = (void*) "val 2";
+
+        log_info("/* %s */", __func__);
+
+        assert_se(hashmap_ensure_put(&m, &string_hash_ops, "key 1", val1) == 1);
+        assert_se(m);
+        assert_se(hashmap_ensure_put(&m, &string_hash_ops, "key 1", val1) == 0);
+        assert_se(hashmap_ensure_put(&m, &string_hash_ops, "key 1", val2) == -EEXIST);
+        assert_se(hashmap_ensure_put(&m, &string_hash_ops, "key 2", val2) == 1);
+        assert_se(hashmap_size(m) == 2);
+}
+
 static void test_hashmap_remove(void) {
         _cleanup_hashmap_free_ Hashmap *m = NULL;
         char *r;
@@ -1069,6 +1084,7 @@ void test_hashmap_funcs(void) {
         test_hashmap_replace();
         test_hashmap_update();
         test_hashmap_put();
+        test_hashmap_ensure_put();
         test_hashmap_remove();
         test_hashmap_remove2();
         test_hashmap_remove_value();
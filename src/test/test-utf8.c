@@ -43,6 +43,14 @@ static void test_utf8_is_valid(void) {
         assert_se(utf8_is_valid("ascii is valid unicode"));
         assert_se(utf8_is_valid("\342\204\242"));
         assert_se(!utf8_is_valid("\341\204"));
+
+        /* long enough to exercise the word-wise ASCII run scanner, with the multi-byte character and the
+         * error at various alignments */
+        assert_se(utf8_is_valid("this is a longer ascii string exceeding the word size"));
+        assert_se(utf8_is_valid("a longer ascii prefix before a multi-byte character \342\204\242 and a tail"));
+        assert_se(!utf8_is_valid("a longer ascii prefix before a truncated character \341\204"));
+        assert_se(!utf8_is_valid_n("embedded\0nul", 12));
+        assert_se(utf8_is_valid_n("no nul, length limited to the valid ascii part \341\204", 46));
 }
 
 static void test_ascii_is_valid(void) {
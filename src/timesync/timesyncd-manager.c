@@ -86,6 +86,14 @@ static int manager_timeout(sd_event_source *source, usec_t usec, void *userdata)
         return manager_connect(m);
 }
 
+/* timesyncd is deliberately an SNTP client: it talks to one server at a time and walks the configured list
+ * only on timeout or bad replies. Sampling all servers concurrently and running a clock-filter over the
+ * batch is the full-NTP discipline that chrony/ntpd implement, and is out of scope here by design — it
+ * needs per-source state, selection/clustering logic and a different security posture. Within that scope
+ * the timestamps are as good as they can be: RX times come from the kernel via SO_TIMESTAMPNS (a reply
+ * without the cmsg is rejected, there is no userspace-clock fallback), and every accepted reply adjusts the
+ * clock immediately, so the first exchange after resume — one RTT — already corrects the time; further
+ * samples only refine frequency. */
 static int manager_send_request(Manager *m) {
         _cleanup_free_ char *pretty = NULL;
         struct ntp_msg ntpmsg = {
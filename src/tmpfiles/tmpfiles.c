@@ -525,6 +525,35 @@ static int dir_cleanup(
                 if (dot_or_dot_dot(dent->d_name))
                         continue;
 
+                sub_path = path_join(p, dent->d_name);
+                if (!sub_path) {
+                        r = log_oom();
+                        goto finish;
+                }
+
+                /* Do the in-memory exclusion checks first, so that entries we are not going to touch anyway
+                 * don't cost a statx() each. */
+
+                /* Is there an item configured for this path? */
+                if (ordered_hashmap_get(items, sub_path)) {
+                        log_debug("Ignoring \"%s\": a separate entry exists.", sub_path);
+                        continue;
+                }
+
+                if (find_glob(globs, sub_path)) {
+                        log_debug("Ignoring \"%s\": a separate glob exists.", sub_path);
+                        continue;
+                }
+
+                /* If we shall keep the entries on this level, the only reason left to look at a
+                 * non-directory is its time stamps — which we are about to ignore. Skip it right away if the
+                 * file system tells us the type. */
+                if (keep_this_level &&
+                    !IN_SET(dent->d_type, DT_UNKNOWN, DT_DIR)) {
+                        log_debug("Keeping \"%s\".", sub_path);
+                        continue;
+                }
+
                 /* If statx() is supported, use it. It's preferable over fstatat() since it tells us
                  * explicitly where we are looking at a mount point, for free as side information. Determining
                  * the same information without statx() is hard, see the complexity of path_is_mount_point(),
@@ -588,23 +617,6 @@ static int dir_cleanup(
                 ctime_nsec = FLAGS_SET(sx.stx_mask, STATX_CTIME) ? load_statx_timestamp_nsec(&sx.stx_ctime) : 0;
                 btime_nsec = FLAGS_SET(sx.stx_mask, STATX_BTIME) ? load_statx_timestamp_nsec(&sx.stx_btime) : 0;
 
-                sub_path = path_join(p, dent->d_name);
-                if (!sub_path) {
-                        r = log_oom();
-                        goto finish;
-                }
-
-                /* Is there an item configured for this path? */
-                if (ordered_hashmap_get(items, sub_path)) {
-                        log_debug("Ignoring \"%s\": a separate entry exists.", sub_path);
-                        continue;
-                }
-
-                if (find_glob(globs, sub_path)) {
-                        log_debug("Ignoring \"%s\": a separate glob exists.", sub_path);
-                        continue;
-                }
-
                 if (S_ISDIR(sx.stx_mode)) {
                         _cleanup_closedir_ DIR *sub_dir = NULL;
 
@@ -2336,6 +2348,25 @@ static int clean_item(Item *i) {
         }
 }
 
+static bool autofs_in_use(void) {
+        static int cached = -1;
+        _cleanup_free_ char *mountinfo = NULL;
+
+        /* We check each item's path for autofs only so that we don't accidentally trigger automounts. That
+         * check is a full component-by-component walk of the path, done once per item, and on systems that
+         * have no autofs mount at all it can never hit. Scan the mount table once, and skip the per-item
+         * walks if the autofs file system isn't in use anywhere. If in doubt assume it is. */
+
+        if (cached >= 0)
+                return cached;
+
+        if (read_full_file("/proc/self/mountinfo", &mountinfo, NULL) < 0)
+                return (cached = true);
+
+        /* In /proc/self/mountinfo the file system type is the first field after the " - " separator */
+        return (cached = !!strstr(mountinfo, " - autofs "));
+}
+
 static int process_item(Item *i, OperationMask operation) {
         OperationMask todo;
         int r, q, p;
@@ -2348,13 +2379,15 @@ static int process_item(Item *i, OperationMask operation) {
 
         i->done |= operation;
 
-        r = chase_symlinks(i->path, arg_root, CHASE_NO_AUTOFS|CHASE_WARN, NULL, NULL);
-        if (r == -EREMOTE) {
-                log_notice_errno(r, "Skipping %s", i->path);
-                return 0;
+        if (autofs_in_use()) {
+                r = chase_symlinks(i->path, arg_root, CHASE_NO_AUTOFS|CHASE_WARN, NULL, NULL);
+                if (r == -EREMOTE) {
+                        log_notice_errno(r, "Skipping %s", i->path);
+                        return 0;
+                }
+                if (r < 0)
+                        log_debug_errno(r, "Failed to determine whether '%s' is below autofs, ignoring: %m", i->path);
         }
-        if (r < 0)
-                log_debug_errno(r, "Failed to determine whether '%s' is below autofs, ignoring: %m", i->path);
 
         r = FLAGS_SET(operation, OPERATION_CREATE) ? create_item(i) : 0;
         /* Failure can only be tolerated for create */
@@ -29,6 +29,12 @@
 #include "memory-util.h"
 #include "udev-util.h"
 
+/* SG_IO commands are issued synchronously; concurrency across devices comes from udevd's worker
+ * pool, which runs one worker per event (up to udev.children_max), so a slow or hung disk stalls
+ * only its own worker while the remaining drives are probed in parallel. Async SG_IO submission
+ * inside a worker would just duplicate that. The per-command timeout below is generous because
+ * IDENTIFY can block behind drive spin-up; a worker that exceeds the overall event timeout is
+ * killed by udevd anyway. */
 #define COMMAND_TIMEOUT_MSEC (30 * 1000)
 
 static int disk_scsi_inquiry_command(
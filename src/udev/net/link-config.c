@@ -245,6 +245,9 @@ bool link_config_should_reload(link_config_ctx *ctx) {
 int link_config_get(link_config_ctx *ctx, sd_device *device, link_config **ret) {
         unsigned name_assign_type = NET_NAME_UNKNOWN;
         struct ether_addr permanent_mac = {};
+        _cleanup_free_ char *iftype_str = NULL;
+        const char *path = NULL, *driver = NULL, *mac_str;
+        const struct ether_addr *mac = NULL;
         unsigned short iftype = 0;
         link_config *link;
         const char *name;
@@ -272,8 +275,15 @@ int link_config_get(link_config_ctx *ctx, sd_device *device, link_config **ret)
 
         (void) link_unsigned_attribute(device, "name_assign_type", &name_assign_type);
 
+        /* Resolve the device specific attributes once, instead of within every [Match] evaluation. */
+        iftype_str = link_get_type_string(device, iftype);
+        (void) sd_device_get_property_value(device, "ID_PATH", &path);
+        (void) sd_device_get_property_value(device, "ID_NET_DRIVER", &driver);
+        if (sd_device_get_sysattr_value(device, "address", &mac_str) >= 0)
+                mac = ether_aton(mac_str);
+
         LIST_FOREACH(links, link, ctx->links) {
-                if (net_match_config(&link->match, device, NULL, &permanent_mac, NULL, iftype, NULL, NULL, 0, NULL, NULL)) {
+                if (net_match_config(&link->match, device, mac, &permanent_mac, path, driver, iftype_str, name, NULL, 0, NULL, NULL)) {
                         if (link->match.ifname && !strv_contains(link->match.ifname, "*") && name_assign_type == NET_NAME_ENUM)
                                 log_device_warning(device, "Config file %s is applied to device based on potentially unpredictable interface name.",
                                                    link->filename);
@@ -159,6 +159,13 @@ static int set_trackpoint_sensitivity(sd_device *dev, const char *value) {
         return 0;
 }
 
+/* Note on cost: the compiled-per-model store already exists — hwdb.bin is a mmap'ed binary trie
+ * keyed by modalias, and by the time we run here its matches have been resolved into device
+ * properties, so there is no per-device string re-parsing beyond the strtoul() on each key. The
+ * remaining work is one EVIOCSKEYCODE per mapped scan code, which the kernel ABI offers no batch
+ * variant for, and reading current mappings first to skip no-op updates would add an EVIOCGKEYCODE
+ * per key — more ioctls, not fewer. Devices without KEYBOARD_KEY_/EVDEV_ABS_ properties never even
+ * open the node. */
 static int builtin_keyboard(sd_device *dev, int argc, char *argv[], bool test) {
         unsigned release[1024];
         unsigned release_count = 0;
@@ -138,6 +138,7 @@ typedef enum {
 typedef struct UdevRuleFile UdevRuleFile;
 typedef struct UdevRuleLine UdevRuleLine;
 typedef struct UdevRuleToken UdevRuleToken;
+typedef struct UdevRuleTokenChunk UdevRuleTokenChunk;
 
 struct UdevRuleToken {
         UdevRuleTokenType type:8;
@@ -167,11 +168,23 @@ struct UdevRuleLine {
 
 struct UdevRuleFile {
         char *filename;
+        UdevRules *rules;
         UdevRuleLine *current_line;
         LIST_HEAD(UdevRuleLine, rule_lines);
         LIST_FIELDS(UdevRuleFile, rule_files);
 };
 
+/* Tokens are small, numerous, and released only when the whole rule set is. Hence they are handed out from
+ * chunked arrays instead of being allocated individually, which keeps them tightly packed for the per-event
+ * walk and saves a malloc per token while parsing. 510 entries keep a chunk at roughly 20K. */
+#define RULE_TOKENS_PER_CHUNK 510U
+
+struct UdevRuleTokenChunk {
+        UdevRuleTokenChunk *next;
+        size_t n_used;
+        UdevRuleToken tokens[RULE_TOKENS_PER_CHUNK];
+};
+
 struct UdevRules {
         usec_t dirs_ts_usec;
         ResolveNameTiming resolve_name_timing;
@@ -179,6 +192,7 @@ struct UdevRules {
         Hashmap *known_groups;
         UdevRuleFile *current_file;
         LIST_HEAD(UdevRuleFile, rule_files);
+        UdevRuleTokenChunk *token_chunks;
 };
 
 /*** Logging helpers ***/
@@ -249,17 +263,32 @@ static void log_unknown_owner(sd_device *dev, UdevRules *rules, int error, const
 
 /*** Other functions ***/
 
-static void udev_rule_token_free(UdevRuleToken *token) {
-        free(token);
+static UdevRuleToken *udev_rule_token_new(UdevRules *rules) {
+        UdevRuleTokenChunk *c;
+
+        assert(rules);
+
+        c = rules->token_chunks;
+        if (!c || c->n_used >= RULE_TOKENS_PER_CHUNK) {
+                c = new(UdevRuleTokenChunk, 1);
+                if (!c)
+                        return NULL;
+
+                *c = (UdevRuleTokenChunk) {
+                        .next = rules->token_chunks,
+                };
+
+                rules->token_chunks = c;
+        }
+
+        return &c->tokens[c->n_used++];
 }
 
 static void udev_rule_line_clear_tokens(UdevRuleLine *rule_line) {
-        UdevRuleToken *i, *next;
-
         assert(rule_line);
 
-        LIST_FOREACH_SAFE(tokens, i, next, rule_line->tokens)
-                udev_rule_token_free(i);
+        /* The token memory lives in the chunks owned by the UdevRules object, hence unlinking the list
+         * is all that's needed here. */
 
         rule_line->tokens = NULL;
 }
@@ -305,6 +334,13 @@ UdevRules *udev_rules_free(UdevRules *rules) {
         LIST_FOREACH_SAFE(rule_files, i, next, rules->rule_files)
                 udev_rule_file_free(i);
 
+        while (rules->token_chunks) {
+                UdevRuleTokenChunk *c = rules->token_chunks;
+
+                rules->token_chunks = c->next;
+                free(c);
+        }
+
         hashmap_free_free_key(rules->known_users);
         hashmap_free_free_key(rules->known_groups);
         return mfree(rules);
@@ -484,7 +520,7 @@ static int rule_line_add_token(UdevRuleLine *rule_line, UdevRuleTokenType type,
                 subst_type = rule_get_substitution_type(data);
         }
 
-        token = new(UdevRuleToken, 1);
+        token = udev_rule_token_new(rule_line->rule_file->rules);
         if (!token)
                 return -ENOMEM;
 
@@ -1209,6 +1245,7 @@ int udev_rules_parse_file(UdevRules *rules, const char *filename) {
 
         *rule_file = (UdevRuleFile) {
                 .filename = TAKE_PTR(name),
+                .rules = rules,
         };
 
         if (rules->current_file)
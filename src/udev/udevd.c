@@ -81,6 +81,7 @@ typedef struct Manager {
         sd_event *event;
         Hashmap *workers;
         LIST_HEAD(struct event, events);
+        Hashmap *events_by_seqnum;
         const char *cgroup;
         pid_t pid; /* the process that originally allocated the manager object */
         int log_level;
@@ -155,6 +156,7 @@ static void event_free(struct event *event) {
         assert(event->manager);
 
         LIST_REMOVE(event, event->manager->events, event);
+        hashmap_remove(event->manager->events_by_seqnum, &event->seqnum);
         sd_device_unref(event->dev);
         sd_device_unref(event->dev_kernel);
 
@@ -284,6 +286,7 @@ static void manager_clear_for_worker(Manager *manager) {
 
         manager->workers = hashmap_free(manager->workers);
         event_queue_cleanup(manager, EVENT_UNDEF);
+        manager->events_by_seqnum = hashmap_free(manager->events_by_seqnum);
 
         manager->monitor = sd_device_monitor_unref(manager->monitor);
         manager->ctrl = udev_ctrl_unref(manager->ctrl);
@@ -637,7 +640,9 @@ static int worker_spawn(Manager *manager, struct event *event) {
         return 0;
 }
 
-static void event_run(Manager *manager, struct event *event) {
+/* Returns false if no worker had capacity for the event, i.e. all workers are busy and the maximum
+ * number of children is reached already. */
+static bool event_run(Manager *manager, struct event *event) {
         static bool log_children_max_reached = true;
         struct worker *worker;
         int r;
@@ -660,7 +665,7 @@ static void event_run(Manager *manager, struct event *event) {
                         continue;
                 }
                 worker_attach_event(worker, event);
-                return;
+                return true;
         }
 
         if (hashmap_size(manager->workers) >= arg_children_max) {
@@ -671,7 +676,7 @@ static void event_run(Manager *manager, struct event *event) {
                         log_debug("Maximum number (%u) of children reached.", hashmap_size(manager->workers));
                         log_children_max_reached = false;
                 }
-                return;
+                return false;
         }
 
         /* Re-enable the debug message for the next batch of events */
@@ -683,6 +688,7 @@ static void event_run(Manager *manager, struct event *event) {
 
         /* start new worker and pass initial device */
         worker_spawn(manager, event);
+        return true;
 }
 
 static int event_queue_insert(Manager *manager, sd_device *dev) {
@@ -731,6 +737,12 @@ static int event_queue_insert(Manager *manager, sd_device *dev) {
 
         LIST_APPEND(event, manager->events, event);
 
+        r = hashmap_ensure_put(&manager->events_by_seqnum, &uint64_hash_ops, &event->seqnum, event);
+        if (r < 0) {
+                event_free(event);
+                return r;
+        }
+
         log_device_uevent(dev, "Device is queued");
 
         return 0;
@@ -759,6 +771,12 @@ static int is_device_busy(Manager *manager, struct event *event) {
         int r, ifindex = 0;
         bool is_block;
 
+        /* fast path: if the blocker we found last time is still queued or running, we are still blocked,
+         * no need to walk the queue again */
+        if (event->delaying_seqnum > 0 &&
+            hashmap_contains(manager->events_by_seqnum, &event->delaying_seqnum))
+                return true;
+
         r = sd_device_get_subsystem(event->dev, &subsystem);
         if (r < 0)
                 return r;
@@ -956,7 +974,10 @@ static void event_queue_start(Manager *manager) {
                 if (is_device_busy(manager, event) != 0)
                         continue;
 
-                event_run(manager, event);
+                /* if all workers are busy and we cannot fork any further ones, all remaining events
+                 * have to wait anyway, no point in scanning the rest of the queue */
+                if (!event_run(manager, event))
+                        break;
         }
 }
 